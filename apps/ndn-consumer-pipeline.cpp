@@ -0,0 +1,334 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-consumer-pipeline.hpp"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/string.h"
+#include "ns3/boolean.h"
+#include "ns3/double.h"
+
+#include <cmath>
+#include <limits>
+
+NS_LOG_COMPONENT_DEFINE("ndn.ConsumerPipeline");
+
+namespace ns3 {
+namespace ndn {
+
+NS_OBJECT_ENSURE_REGISTERED(ConsumerPipeline);
+
+TypeId
+ConsumerPipeline::GetTypeId(void)
+{
+  static TypeId tid =
+    TypeId("ns3::ndn::ConsumerPipeline")
+      .SetGroupName("Ndn")
+      .SetParent<ConsumerWindow>()
+      .AddConstructor<ConsumerPipeline>()
+
+      .AddAttribute("CcAlgorithm", "Congestion control algorithm: AIMD (default), CUBIC",
+                    StringValue("AIMD"),
+                    MakeStringAccessor(&ConsumerPipeline::SetCcAlgorithm,
+                                       &ConsumerPipeline::GetCcAlgorithm),
+                    MakeStringChecker())
+
+      .AddAttribute("Beta", "Multiplicative decrease factor of AIMD", DoubleValue(0.5),
+                    MakeDoubleAccessor(&ConsumerPipeline::m_beta),
+                    MakeDoubleChecker<double>(0.0, 1.0))
+
+      .AddAttribute("CubicBeta", "Multiplicative decrease factor of CUBIC", DoubleValue(0.7),
+                    MakeDoubleAccessor(&ConsumerPipeline::m_cubicBeta),
+                    MakeDoubleChecker<double>(0.0, 1.0))
+
+      .AddAttribute("CubicC", "Scaling constant of CUBIC window growth function", DoubleValue(0.4),
+                    MakeDoubleAccessor(&ConsumerPipeline::m_cubicC),
+                    MakeDoubleChecker<double>(0.0))
+
+      .AddAttribute("UseCubicFastConvergence",
+                    "Release bandwidth faster when CUBIC window is reduced before reaching the "
+                    "previous maximum",
+                    BooleanValue(false),
+                    MakeBooleanAccessor(&ConsumerPipeline::m_useCubicFastConvergence),
+                    MakeBooleanChecker())
+
+      .AddAttribute("ConservativeWindowAdaptation",
+                    "Decrease window at most once per window of Interests (losses of Interests "
+                    "sent before the last decrease are ignored)",
+                    BooleanValue(true), MakeBooleanAccessor(&ConsumerPipeline::m_useCwa),
+                    MakeBooleanChecker())
+
+      .AddAttribute("NackBackoff",
+                    "Delay before retransmission of a Nacked Interest, doubled for every "
+                    "consecutive Nack up to RTO",
+                    StringValue("10ms"), MakeTimeAccessor(&ConsumerPipeline::m_initialNackBackoff),
+                    MakeTimeChecker())
+
+      .AddAttribute("Segmented",
+                    "Use segment numbers instead of sequence numbers in Interest names and stop "
+                    "at FinalBlockId of the received Data",
+                    BooleanValue(false), MakeBooleanAccessor(&ConsumerPipeline::m_segmented),
+                    MakeBooleanChecker())
+
+      .AddTraceSource("CongestionWindow", "Current congestion window",
+                      MakeTraceSourceAccessor(&ConsumerPipeline::m_cwnd),
+                      "ns3::ndn::ConsumerPipeline::CongestionWindowTraceCallback")
+      .AddTraceSource("SlowStartThreshold", "Current slow start threshold",
+                      MakeTraceSourceAccessor(&ConsumerPipeline::m_ssthresh),
+                      "ns3::ndn::ConsumerPipeline::CongestionWindowTraceCallback");
+
+  return tid;
+}
+
+ConsumerPipeline::ConsumerPipeline()
+  : m_ccAlgorithm(AIMD)
+  , m_segmented(false)
+  , m_cwnd(1.0)
+  , m_ssthresh(std::numeric_limits<double>::max())
+  , m_recoveryPoint(0)
+  , m_cubicWmax(0.0)
+{
+}
+
+void
+ConsumerPipeline::SetCcAlgorithm(const std::string& algorithm)
+{
+  if (algorithm == "AIMD") {
+    m_ccAlgorithm = AIMD;
+  }
+  else if (algorithm == "CUBIC") {
+    m_ccAlgorithm = CUBIC;
+  }
+  else {
+    NS_FATAL_ERROR("Unknown congestion control algorithm [" << algorithm
+                                                            << "], should be AIMD or CUBIC");
+  }
+}
+
+std::string
+ConsumerPipeline::GetCcAlgorithm() const
+{
+  return m_ccAlgorithm == CUBIC ? "CUBIC" : "AIMD";
+}
+
+void
+ConsumerPipeline::SetWindow(uint32_t window)
+{
+  ConsumerWindow::SetWindow(window);
+  m_cwnd = window;
+}
+
+void
+ConsumerPipeline::AppendSequenceNumber(Name& name, uint32_t seq) const
+{
+  if (m_segmented) {
+    name.appendSegment(seq);
+  }
+  else {
+    name.appendSequenceNumber(seq);
+  }
+}
+
+uint32_t
+ConsumerPipeline::GetSequenceNumber(const Name& name) const
+{
+  if (m_segmented) {
+    return name.at(-1).toSegment();
+  }
+  return name.at(-1).toSequenceNumber();
+}
+
+void
+ConsumerPipeline::ScheduleNextPacket()
+{
+  Time now = Simulator::Now();
+  if (now < m_backoffUntil) {
+    // hold all transmissions until the Nack back-off expires
+    if (m_sendEvent.IsRunning()) {
+      if (m_sendEvent.GetTs() >= static_cast<uint64_t>(m_backoffUntil.GetTimeStep())) {
+        return;
+      }
+      Simulator::Remove(m_sendEvent);
+    }
+    m_sendEvent = Simulator::Schedule(m_backoffUntil - now, &Consumer::SendPacket, this);
+    return;
+  }
+
+  ConsumerWindow::ScheduleNextPacket();
+}
+
+///////////////////////////////////////////////////
+//          Process incoming packets             //
+///////////////////////////////////////////////////
+
+void
+ConsumerPipeline::OnData(shared_ptr<const Data> data)
+{
+  Consumer::OnData(data);
+
+  if (m_inFlight > static_cast<uint32_t>(0))
+    m_inFlight--;
+
+  if (m_segmented && !data->getFinalBlockId().empty()) {
+    uint64_t lastSegment = data->getFinalBlockId().toSegment();
+    if (lastSegment < m_seqMax) {
+      m_seqMax = lastSegment + 1;
+    }
+  }
+
+  m_nackBackoff = Time();
+  IncreaseWindow();
+
+  NS_LOG_DEBUG("Window: " << m_cwnd << ", ssthresh: " << m_ssthresh
+                          << ", InFlight: " << m_inFlight);
+  ScheduleNextPacket();
+}
+
+void
+ConsumerPipeline::OnNack(shared_ptr<const lp::Nack> nack)
+{
+  Consumer::OnNack(nack); // tracing inside
+
+  uint32_t seq = GetSequenceNumber(nack->getInterest().getName());
+  SeqState* state = m_seqStates.Find(seq);
+  if (state == nullptr || !state->pendingTimeout) {
+    return; // Data already received or timeout already processed
+  }
+
+  // Interest is no longer outstanding: cancel its timeout and schedule retransmission
+  state->pendingTimeout = false;
+  if (!state->pendingRetx) {
+    state->pendingRetx = true;
+    m_retxSeqs.push(seq);
+  }
+
+  if (m_inFlight > static_cast<uint32_t>(0))
+    m_inFlight--;
+
+  DecreaseWindow(seq, false);
+
+  Time rto = m_rtt->RetransmitTimeout();
+  m_nackBackoff = m_nackBackoff.IsZero() ? m_initialNackBackoff
+                                         : std::min(m_nackBackoff + m_nackBackoff, rto);
+  m_backoffUntil = Simulator::Now() + m_nackBackoff;
+  NS_LOG_DEBUG("Back-off for " << m_nackBackoff.As(Time::S));
+
+  if (m_retxTimerOnDemand) {
+    ScheduleRetxCheck();
+  }
+  ScheduleNextPacket();
+}
+
+void
+ConsumerPipeline::OnTimeout(uint32_t sequenceNumber)
+{
+  if (m_inFlight > static_cast<uint32_t>(0))
+    m_inFlight--;
+
+  DecreaseWindow(sequenceNumber, true);
+
+  NS_LOG_DEBUG("Window: " << m_cwnd << ", ssthresh: " << m_ssthresh
+                          << ", InFlight: " << m_inFlight);
+  Consumer::OnTimeout(sequenceNumber);
+}
+
+void
+ConsumerPipeline::IncreaseWindow()
+{
+  double cwnd = m_cwnd.Get();
+
+  if (cwnd < m_ssthresh) {
+    cwnd += 1.0; // slow start
+  }
+  else if (m_ccAlgorithm == AIMD) {
+    cwnd += 1.0 / cwnd;
+  }
+  else {
+    Time now = Simulator::Now();
+    if (m_cubicWmax <= 0.0) { // congestion avoidance entered without a loss
+      m_cubicWmax = cwnd;
+      m_cubicLastDecrease = now;
+    }
+
+    double t = (now - m_cubicLastDecrease).GetSeconds();
+    double rtt = m_rtt->GetCurrentEstimate().GetSeconds();
+    double k = std::cbrt(m_cubicWmax * (1.0 - m_cubicBeta) / m_cubicC);
+
+    // window the CUBIC function reaches in one RTT
+    double target = m_cubicC * std::pow(t + rtt - k, 3) + m_cubicWmax;
+    if (target > cwnd) {
+      cwnd += (target - cwnd) / cwnd;
+    }
+    else {
+      cwnd += 0.01 / cwnd;
+    }
+
+    // TCP-friendly region: grow at least as fast as AIMD with the same decrease factor
+    if (rtt > 0.0) {
+      double aimdWindow = m_cubicWmax * m_cubicBeta
+                          + 3.0 * (1.0 - m_cubicBeta) / (1.0 + m_cubicBeta) * t / rtt;
+      cwnd = std::max(cwnd, aimdWindow);
+    }
+  }
+
+  m_cwnd = cwnd;
+  UpdateWindow();
+}
+
+void
+ConsumerPipeline::DecreaseWindow(uint32_t seq, bool isTimeout)
+{
+  if (m_useCwa && seq < m_recoveryPoint) {
+    NS_LOG_DEBUG("Loss of " << seq << " belongs to already reduced window");
+    return;
+  }
+  m_recoveryPoint = m_seq; // Interests sent so far belong to the reduced window
+
+  double cwnd = m_cwnd.Get();
+  if (m_ccAlgorithm == CUBIC) {
+    if (m_useCubicFastConvergence && cwnd < m_cubicWmax) {
+      m_cubicWmax = cwnd * (1.0 + m_cubicBeta) / 2.0;
+    }
+    else {
+      m_cubicWmax = cwnd;
+    }
+    m_cubicLastDecrease = Simulator::Now();
+    m_ssthresh = std::max(2.0, cwnd * m_cubicBeta);
+  }
+  else {
+    m_ssthresh = std::max(2.0, cwnd * m_beta);
+  }
+
+  if (isTimeout && m_setInitialWindowOnTimeout) {
+    m_cwnd = m_initialWindow; // restart with slow start
+  }
+  else {
+    m_cwnd = m_ssthresh.Get();
+  }
+  UpdateWindow();
+}
+
+void
+ConsumerPipeline::UpdateWindow()
+{
+  m_window = std::max<uint32_t>(1, static_cast<uint32_t>(m_cwnd.Get()));
+}
+
+} // namespace ndn
+} // namespace ns3
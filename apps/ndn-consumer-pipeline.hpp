@@ -0,0 +1,135 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_CONSUMER_PIPELINE_H
+#define NDN_CONSUMER_PIPELINE_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ndn-consumer-window.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-apps
+ * \brief Ndn application for pipelined Interest transmission with congestion control
+ *
+ * The number of outstanding Interests is controlled by a congestion window which grows
+ * exponentially while below slow start threshold and then either linearly (AIMD) or following
+ * CUBIC function of the time since the last window decrease.  Timeouts and Nacks decrease the
+ * window (at most once per window of Interests if ConservativeWindowAdaptation is enabled),
+ * Nacked Interests are retransmitted after an exponentially growing back-off.
+ *
+ * With Segmented attribute, Interest names carry segment numbers instead of sequence numbers
+ * and the fetch stops at the FinalBlockId advertised by the producer, if any.
+ */
+class ConsumerPipeline : public ConsumerWindow {
+public:
+  static TypeId
+  GetTypeId();
+
+  /**
+   * \brief Default constructor
+   */
+  ConsumerPipeline();
+
+  // From App
+  virtual void
+  OnData(shared_ptr<const Data> data);
+
+  virtual void
+  OnNack(shared_ptr<const lp::Nack> nack);
+
+  virtual void
+  OnTimeout(uint32_t sequenceNumber);
+
+public:
+  typedef void (*CongestionWindowTraceCallback)(double);
+
+protected:
+  virtual void
+  ScheduleNextPacket();
+
+  virtual void
+  SetWindow(uint32_t window);
+
+  virtual void
+  AppendSequenceNumber(Name& name, uint32_t seq) const;
+
+  virtual uint32_t
+  GetSequenceNumber(const Name& name) const;
+
+private:
+  void
+  SetCcAlgorithm(const std::string& algorithm);
+
+  std::string
+  GetCcAlgorithm() const;
+
+  /**
+   * \brief Grows congestion window after Data is received
+   */
+  void
+  IncreaseWindow();
+
+  /**
+   * \brief Multiplicatively decreases congestion window after loss of the Interest
+   * \param seq sequence number of the lost Interest
+   * \param isTimeout whether the loss was detected by the timeout (otherwise Nack)
+   */
+  void
+  DecreaseWindow(uint32_t seq, bool isTimeout);
+
+  /**
+   * \brief Updates integer window of ConsumerWindow from the congestion window
+   */
+  void
+  UpdateWindow();
+
+private:
+  enum CcAlgorithm {
+    AIMD,
+    CUBIC
+  };
+
+  CcAlgorithm m_ccAlgorithm;
+  double m_beta;      ///< \brief multiplicative decrease factor for AIMD
+  double m_cubicBeta; ///< \brief multiplicative decrease factor for CUBIC
+  double m_cubicC;    ///< \brief scaling constant of CUBIC window function
+  bool m_useCubicFastConvergence;
+  bool m_useCwa; ///< \brief decrease window at most once per window of Interests
+  bool m_segmented;
+  Time m_initialNackBackoff;
+
+  TracedValue<double> m_cwnd;
+  TracedValue<double> m_ssthresh;
+
+  uint32_t m_recoveryPoint; ///< \brief losses of Interests below this sequence number are ignored
+  double m_cubicWmax;       ///< \brief window size before the last decrease
+  Time m_cubicLastDecrease;
+
+  Time m_nackBackoff;  ///< \brief current back-off, zero if the last reaction was not a Nack
+  Time m_backoffUntil; ///< \brief no Interests are sent before this time
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif
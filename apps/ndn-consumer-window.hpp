@@ -67,7 +67,6 @@ protected:
   virtual void
   ScheduleNextPacket();
 
-private:
   virtual void
   SetWindow(uint32_t window);
 
@@ -96,6 +95,7 @@ private:
   uint32_t m_payloadSize; // expected payload size
   double m_maxSize;       // max size to request
 
+protected:
   uint32_t m_initialWindow;
   bool m_setInitialWindowOnTimeout;
 
@@ -52,15 +52,24 @@ ConsumerZipfMandelbrot::GetTypeId(void)
       .AddAttribute("s", "parameter of power", StringValue("0.7"),
                     MakeDoubleAccessor(&ConsumerZipfMandelbrot::SetS,
                                        &ConsumerZipfMandelbrot::GetS),
-                    MakeDoubleChecker<double>());
+                    MakeDoubleChecker<double>())
+
+      .AddAttribute("SamplingMethod",
+                    "How content ranks are sampled: binary-search (O(log N) per Interest) or "
+                    "alias (O(1) per Interest, larger table)",
+                    StringValue("binary-search"),
+                    MakeStringAccessor(&ConsumerZipfMandelbrot::SetSamplingMethod,
+                                       &ConsumerZipfMandelbrot::GetSamplingMethod),
+                    MakeStringChecker());
 
   return tid;
 }
 
 ConsumerZipfMandelbrot::ConsumerZipfMandelbrot()
-  : m_N(100) // needed here to make sure when SetQ/SetS are called, there is a valid value of N
+  : m_N(100)
   , m_q(0.7)
   , m_s(0.7)
+  , m_method(ZipfTable::BINARY_SEARCH)
   , m_seqRng(CreateObject<UniformRandomVariable>())
 {
   // SetNumberOfContents is called by NS-3 object system during the initialization
@@ -74,20 +83,7 @@ void
 ConsumerZipfMandelbrot::SetNumberOfContents(uint32_t numOfContents)
 {
   m_N = numOfContents;
-
-  NS_LOG_DEBUG(m_q << " and " << m_s << " and " << m_N);
-
-  m_Pcum = std::vector<double>(m_N + 1);
-
-  m_Pcum[0] = 0.0;
-  for (uint32_t i = 1; i <= m_N; i++) {
-    m_Pcum[i] = m_Pcum[i - 1] + 1.0 / std::pow(i + m_q, m_s);
-  }
-
-  for (uint32_t i = 1; i <= m_N; i++) {
-    m_Pcum[i] = m_Pcum[i] / m_Pcum[m_N];
-    NS_LOG_LOGIC("Cumulative probability [" << i << "]=" << m_Pcum[i]);
-  }
+  m_table.reset(); // will be rebuilt (or found in cache) by GetNextSeq
 }
 
 uint32_t
@@ -100,7 +96,7 @@ void
 ConsumerZipfMandelbrot::SetQ(double q)
 {
   m_q = q;
-  SetNumberOfContents(m_N);
+  m_table.reset();
 }
 
 double
@@ -113,7 +109,7 @@ void
 ConsumerZipfMandelbrot::SetS(double s)
 {
   m_s = s;
-  SetNumberOfContents(m_N);
+  m_table.reset();
 }
 
 double
@@ -122,6 +118,27 @@ ConsumerZipfMandelbrot::GetS() const
   return m_s;
 }
 
+void
+ConsumerZipfMandelbrot::SetSamplingMethod(const std::string& method)
+{
+  if (method == "binary-search") {
+    m_method = ZipfTable::BINARY_SEARCH;
+  }
+  else if (method == "alias") {
+    m_method = ZipfTable::ALIAS;
+  }
+  else {
+    NS_FATAL_ERROR("Unknown sampling method [" << method << "], should be binary-search or alias");
+  }
+  m_table.reset();
+}
+
+std::string
+ConsumerZipfMandelbrot::GetSamplingMethod() const
+{
+  return m_method == ZipfTable::ALIAS ? "alias" : "binary-search";
+}
+
 void
 ConsumerZipfMandelbrot::SendPacket()
 {
@@ -130,25 +147,9 @@ ConsumerZipfMandelbrot::SendPacket()
 
   NS_LOG_FUNCTION_NOARGS();
 
-  uint32_t seq = std::numeric_limits<uint32_t>::max(); // invalid
-
-  // std::cout << Simulator::Now ().ToDouble (Time::S) << "s max -> " << m_seqMax << "\n";
-
-  while (m_retxSeqs.size()) {
-    seq = *m_retxSeqs.begin();
-    m_retxSeqs.erase(m_retxSeqs.begin());
-
-    // NS_ASSERT (m_seqLifetimes.find (seq) != m_seqLifetimes.end ());
-    // if (m_seqLifetimes.find (seq)->time <= Simulator::Now ())
-    //   {
-
-    //     NS_LOG_DEBUG ("Expire " << seq);
-    //     m_seqLifetimes.erase (seq); // lifetime expired. Trying to find another unexpired
-    //     sequence number
-    //     continue;
-    //   }
+  uint32_t seq = PopRetxSeq(); // std::numeric_limits<uint32_t>::max() if nothing to retransmit
+  if (seq != std::numeric_limits<uint32_t>::max()) {
     NS_LOG_DEBUG("=interest seq " << seq << " from m_retxSeqs");
-    break;
   }
 
   if (seq == std::numeric_limits<uint32_t>::max()) // no retransmission
@@ -167,7 +168,7 @@ ConsumerZipfMandelbrot::SendPacket()
 
   //
   shared_ptr<Name> nameWithSequence = make_shared<Name>(m_interestName);
-  nameWithSequence->appendSequenceNumber(seq);
+  AppendSequenceNumber(*nameWithSequence, seq);
   //
 
   shared_ptr<Interest> interest = make_shared<Interest>();
@@ -176,18 +177,7 @@ ConsumerZipfMandelbrot::SendPacket()
 
   // NS_LOG_INFO ("Requesting Interest: \n" << *interest);
   NS_LOG_INFO("> Interest for " << seq << ", Total: " << m_seq << ", face: " << m_face->getId());
-  NS_LOG_DEBUG("Trying to add " << seq << " with " << Simulator::Now() << ". already "
-                                << m_seqTimeouts.size() << " items");
-
-  m_seqTimeouts.insert(SeqTimeout(seq, Simulator::Now()));
-  m_seqFullDelay.insert(SeqTimeout(seq, Simulator::Now()));
-
-  m_seqLastDelay.erase(seq);
-  m_seqLastDelay.insert(SeqTimeout(seq, Simulator::Now()));
-
-  m_seqRetxCounts[seq]++;
-
-  m_rtt->SentSeq(SequenceNumber32(seq), 1);
+  WillSendOutInterest(seq);
 
   m_transmittedInterests(interest, this, m_face);
   m_appLink->onReceiveInterest(*interest);
@@ -198,24 +188,17 @@ ConsumerZipfMandelbrot::SendPacket()
 uint32_t
 ConsumerZipfMandelbrot::GetNextSeq()
 {
-  uint32_t content_index = 1; //[1, m_N]
-  double p_sum = 0;
+  if (m_table == nullptr) {
+    m_table = ZipfTable::Get(m_N, m_q, m_s, m_method);
+  }
 
   double p_random = m_seqRng->GetValue();
   while (p_random == 0) {
     p_random = m_seqRng->GetValue();
   }
-  // if (p_random == 0)
   NS_LOG_LOGIC("p_random=" << p_random);
-  for (uint32_t i = 1; i <= m_N; i++) {
-    p_sum = m_Pcum[i]; // m_Pcum[i] = m_Pcum[i-1] + p[i], p[0] = 0;   e.g.: p_cum[1] = p[1],
-                       // p_cum[2] = p[1] + p[2]
-    if (p_random <= p_sum) {
-      content_index = i;
-      break;
-    } // if
-  }   // for
-  // content_index = 1;
+
+  uint32_t content_index = m_table->Sample(p_random); //[1, m_N]
   NS_LOG_DEBUG("RandomNumber=" << content_index);
   return content_index;
 }
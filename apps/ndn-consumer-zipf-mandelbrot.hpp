@@ -27,6 +27,8 @@
 #include "ndn-consumer.hpp"
 #include "ndn-consumer-cbr.hpp"
 
+#include "ns3/ndnSIM/utils/ndn-zipf-table.hpp"
+
 #include "ns3/ptr.h"
 #include "ns3/log.h"
 #include "ns3/simulator.h"
@@ -90,11 +92,21 @@ private:
   double
   GetS() const;
 
+  void
+  SetSamplingMethod(const std::string& method);
+
+  std::string
+  GetSamplingMethod() const;
+
 private:
   uint32_t m_N;               // number of the contents
   double m_q;                 // q in (k+q)^s
   double m_s;                 // s in (k+q)^s
-  std::vector<double> m_Pcum; // cumulative probability
+  ZipfTable::Method m_method; // how ranks are sampled from the table
+
+  // built on first use (after all attributes are set), shared between consumers with the same
+  // parameters
+  shared_ptr<const ZipfTable> m_table;
 
   Ptr<UniformRandomVariable> m_seqRng; // RNG
 };
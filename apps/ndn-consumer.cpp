@@ -65,6 +65,15 @@ Consumer::GetTypeId(void)
                     MakeTimeAccessor(&Consumer::GetRetxTimer, &Consumer::SetRetxTimer),
                     MakeTimeChecker())
 
+      .AddAttribute("RetxTimerOnDemand",
+                    "Instead of checking retransmission timeouts every RetxTimer, schedule a "
+                    "single check for the earliest outstanding deadline (idle consumers do not "
+                    "generate any events)",
+                    BooleanValue(false),
+                    MakeBooleanAccessor(&Consumer::SetRetxTimerOnDemand,
+                                        &Consumer::GetRetxTimerOnDemand),
+                    MakeBooleanChecker())
+
       .AddTraceSource("LastRetransmittedInterestDataDelay",
                       "Delay between last retransmitted Interest and received Data",
                       MakeTraceSourceAccessor(&Consumer::m_lastRetransmittedInterestDataDelay),
@@ -73,7 +82,13 @@ Consumer::GetTypeId(void)
       .AddTraceSource("FirstInterestDataDelay",
                       "Delay between first transmitted Interest and received Data",
                       MakeTraceSourceAccessor(&Consumer::m_firstInterestDataDelay),
-                      "ns3::ndn::Consumer::FirstInterestDataDelayCallback");
+                      "ns3::ndn::Consumer::FirstInterestDataDelayCallback")
+
+      .AddTraceSource("RetxCheck",
+                      "Check of retransmission timeouts (every RetxTimer, or only for the "
+                      "earliest deadline with RetxTimerOnDemand)",
+                      MakeTraceSourceAccessor(&Consumer::m_retxCheck),
+                      "ns3::ndn::Consumer::RetxCheckCallback");
 
   return tid;
 }
@@ -82,6 +97,7 @@ Consumer::Consumer()
   : m_rand(CreateObject<UniformRandomVariable>())
   , m_seq(0)
   , m_seqMax(0) // don't request anything
+  , m_retxTimerOnDemand(false)
 {
   NS_LOG_FUNCTION_NOARGS();
 
@@ -92,6 +108,10 @@ void
 Consumer::SetRetxTimer(Time retxTimer)
 {
   m_retxTimer = retxTimer;
+  if (m_retxTimerOnDemand) {
+    return; // RetxTimer is not used
+  }
+
   if (m_retxEvent.IsRunning()) {
     // m_retxEvent.Cancel (); // cancel any scheduled cleanup events
     Simulator::Remove(m_retxEvent); // slower, but better for memory
@@ -101,6 +121,57 @@ Consumer::SetRetxTimer(Time retxTimer)
   m_retxEvent = Simulator::Schedule(m_retxTimer, &Consumer::CheckRetxTimeout, this);
 }
 
+void
+Consumer::SetRetxTimerOnDemand(bool onDemand)
+{
+  m_retxTimerOnDemand = onDemand;
+  if (m_retxTimerOnDemand) {
+    ScheduleRetxCheck();
+  }
+  else {
+    SetRetxTimer(m_retxTimer);
+  }
+}
+
+bool
+Consumer::GetRetxTimerOnDemand() const
+{
+  return m_retxTimerOnDemand;
+}
+
+bool
+Consumer::IsStale(const SeqTimeout& entry)
+{
+  SeqState* state = m_seqStates.Find(entry.seq);
+  return state == nullptr || !state->pendingTimeout || state->timeoutSent != entry.time;
+}
+
+void
+Consumer::ScheduleRetxCheck()
+{
+  while (!m_seqTimeouts.empty() && IsStale(m_seqTimeouts.front())) {
+    m_seqTimeouts.pop_front();
+  }
+
+  if (m_seqTimeouts.empty()) {
+    if (m_retxEvent.IsRunning()) {
+      Simulator::Remove(m_retxEvent);
+    }
+    return;
+  }
+
+  Time deadline = std::max(m_seqTimeouts.front().time + m_rtt->RetransmitTimeout(),
+                           Simulator::Now());
+  if (m_retxEvent.IsRunning()) {
+    if (m_retxEvent.GetTs() <= static_cast<uint64_t>(deadline.GetTimeStep())) {
+      return; // check at or before the deadline is already scheduled, it will re-arm the timer
+    }
+    Simulator::Remove(m_retxEvent);
+  }
+
+  m_retxEvent = Simulator::Schedule(deadline - Simulator::Now(), &Consumer::CheckRetxTimeout, this);
+}
+
 Time
 Consumer::GetRetxTimer() const
 {
@@ -110,25 +181,64 @@ Consumer::GetRetxTimer() const
 void
 Consumer::CheckRetxTimeout()
 {
+  m_retxCheck(this);
   Time now = Simulator::Now();
 
   Time rto = m_rtt->RetransmitTimeout();
   // NS_LOG_DEBUG ("Current RTO: " << rto.ToDouble (Time::S) << "s");
 
   while (!m_seqTimeouts.empty()) {
-    SeqTimeoutsContainer::index<i_timestamp>::type::iterator entry =
-      m_seqTimeouts.get<i_timestamp>().begin();
-    if (entry->time + rto <= now) // timeout expired?
+    const SeqTimeout& entry = m_seqTimeouts.front();
+    if (IsStale(entry)) {
+      m_seqTimeouts.pop_front(); // Data already received or Interest retransmitted
+      continue;
+    }
+
+    if (entry.time + rto <= now) // timeout expired?
     {
-      uint32_t seqNo = entry->seq;
-      m_seqTimeouts.get<i_timestamp>().erase(entry);
+      uint32_t seqNo = entry.seq;
+      m_seqStates.Find(seqNo)->pendingTimeout = false;
+      m_seqTimeouts.pop_front();
       OnTimeout(seqNo);
     }
     else
       break; // nothing else to do. All later packets need not be retransmitted
   }
 
-  m_retxEvent = Simulator::Schedule(m_retxTimer, &Consumer::CheckRetxTimeout, this);
+  if (m_retxTimerOnDemand) {
+    ScheduleRetxCheck();
+  }
+  else {
+    m_retxEvent = Simulator::Schedule(m_retxTimer, &Consumer::CheckRetxTimeout, this);
+  }
+}
+
+uint32_t
+Consumer::PopRetxSeq()
+{
+  while (!m_retxSeqs.empty()) {
+    uint32_t seq = m_retxSeqs.top();
+    m_retxSeqs.pop();
+
+    SeqState* state = m_seqStates.Find(seq);
+    if (state != nullptr && state->pendingRetx) {
+      state->pendingRetx = false;
+      return seq;
+    }
+  }
+  return std::numeric_limits<uint32_t>::max();
+}
+
+void
+Consumer::AppendSequenceNumber(Name& name, uint32_t seq) const
+{
+  name.appendSequenceNumber(seq);
+}
+
+uint32_t
+Consumer::GetSequenceNumber(const Name& name) const
+{
+  return name.at(-1).toSequenceNumber();
 }
 
 // Application Methods
@@ -163,13 +273,7 @@ Consumer::SendPacket()
 
   NS_LOG_FUNCTION_NOARGS();
 
-  uint32_t seq = std::numeric_limits<uint32_t>::max(); // invalid
-
-  while (m_retxSeqs.size()) {
-    seq = *m_retxSeqs.begin();
-    m_retxSeqs.erase(m_retxSeqs.begin());
-    break;
-  }
+  uint32_t seq = PopRetxSeq(); // std::numeric_limits<uint32_t>::max() if nothing to retransmit
 
   if (seq == std::numeric_limits<uint32_t>::max()) {
     if (m_seqMax != std::numeric_limits<uint32_t>::max()) {
@@ -183,7 +287,7 @@ Consumer::SendPacket()
 
   //
   shared_ptr<Name> nameWithSequence = make_shared<Name>(m_interestName);
-  nameWithSequence->appendSequenceNumber(seq);
+  AppendSequenceNumber(*nameWithSequence, seq);
   //
 
   // shared_ptr<Interest> interest = make_shared<Interest> ();
@@ -221,7 +325,7 @@ Consumer::OnData(shared_ptr<const Data> data)
   // NS_LOG_INFO ("Received content object: " << boost::cref(*data));
 
   // This could be a problem......
-  uint32_t seq = data->getName().at(-1).toSequenceNumber();
+  uint32_t seq = GetSequenceNumber(data->getName());
   NS_LOG_INFO("< DATA for " << seq);
 
   int hopCount = 0;
@@ -231,24 +335,22 @@ Consumer::OnData(shared_ptr<const Data> data)
   }
   NS_LOG_DEBUG("Hop count: " << hopCount);
 
-  SeqTimeoutsContainer::iterator entry = m_seqLastDelay.find(seq);
-  if (entry != m_seqLastDelay.end()) {
-    m_lastRetransmittedInterestDataDelay(this, seq, Simulator::Now() - entry->time, hopCount);
-  }
+  SeqState* state = m_seqStates.Find(seq);
+  if (state != nullptr) {
+    Time lastDelay = Simulator::Now() - state->lastSent;
+    Time fullDelay = Simulator::Now() - state->firstSent;
+    uint32_t retxCount = state->retxCount;
+    m_seqStates.Erase(seq); // also cancels pending timeout and retransmission
 
-  entry = m_seqFullDelay.find(seq);
-  if (entry != m_seqFullDelay.end()) {
-    m_firstInterestDataDelay(this, seq, Simulator::Now() - entry->time, m_seqRetxCounts[seq], hopCount);
+    m_lastRetransmittedInterestDataDelay(this, seq, lastDelay, hopCount);
+    m_firstInterestDataDelay(this, seq, fullDelay, retxCount, hopCount);
   }
 
-  m_seqRetxCounts.erase(seq);
-  m_seqFullDelay.erase(seq);
-  m_seqLastDelay.erase(seq);
-
-  m_seqTimeouts.erase(seq);
-  m_retxSeqs.erase(seq);
-
   m_rtt->AckSeq(SequenceNumber32(seq));
+
+  if (m_retxTimerOnDemand) {
+    ScheduleRetxCheck(); // RTO may have changed, acknowledged Interest may have been the earliest
+  }
 }
 
 void
@@ -271,7 +373,11 @@ Consumer::OnTimeout(uint32_t sequenceNumber)
   m_rtt->IncreaseMultiplier(); // Double the next RTO
   m_rtt->SentSeq(SequenceNumber32(sequenceNumber),
                  1); // make sure to disable RTT calculation for this sample
-  m_retxSeqs.insert(sequenceNumber);
+  SeqState& state = m_seqStates.Insert(sequenceNumber);
+  if (!state.pendingRetx) {
+    state.pendingRetx = true;
+    m_retxSeqs.push(sequenceNumber);
+  }
   ScheduleNextPacket();
 }
 
@@ -279,17 +385,28 @@ void
 Consumer::WillSendOutInterest(uint32_t sequenceNumber)
 {
   NS_LOG_DEBUG("Trying to add " << sequenceNumber << " with " << Simulator::Now() << ". already "
-                                << m_seqTimeouts.size() << " items");
+                                << m_seqStates.GetSize() << " items");
 
-  m_seqTimeouts.insert(SeqTimeout(sequenceNumber, Simulator::Now()));
-  m_seqFullDelay.insert(SeqTimeout(sequenceNumber, Simulator::Now()));
+  Time now = Simulator::Now();
+  SeqState& state = m_seqStates.Insert(sequenceNumber);
 
-  m_seqLastDelay.erase(sequenceNumber);
-  m_seqLastDelay.insert(SeqTimeout(sequenceNumber, Simulator::Now()));
+  if (!state.pendingTimeout) { // otherwise timeout is still counted from the earlier transmission
+    state.pendingTimeout = true;
+    state.timeoutSent = now;
+    m_seqTimeouts.push_back(SeqTimeout(sequenceNumber, now));
+  }
 
-  m_seqRetxCounts[sequenceNumber]++;
+  if (state.retxCount == 0) {
+    state.firstSent = now;
+  }
+  state.lastSent = now;
+  state.retxCount++;
 
   m_rtt->SentSeq(SequenceNumber32(sequenceNumber), 1);
+
+  if (m_retxTimerOnDemand) {
+    ScheduleRetxCheck();
+  }
 }
 
 } // namespace ndn
@@ -31,13 +31,11 @@
 #include "ns3/ndnSIM/model/ndn-common.hpp"
 #include "ns3/ndnSIM/utils/ndn-rtt-estimator.hpp"
 
-#include <set>
-#include <map>
+#include "ns3/ndnSIM/utils/ndn-seq-state-table.hpp"
 
-#include <boost/multi_index_container.hpp>
-#include <boost/multi_index/tag.hpp>
-#include <boost/multi_index/ordered_index.hpp>
-#include <boost/multi_index/member.hpp>
+#include <deque>
+#include <queue>
+#include <vector>
 
 namespace ns3 {
 namespace ndn {
@@ -95,6 +93,7 @@ public:
 public:
   typedef void (*LastRetransmittedInterestDataDelayCallback)(Ptr<App> app, uint32_t seqno, Time delay, int32_t hopCount);
   typedef void (*FirstInterestDataDelayCallback)(Ptr<App> app, uint32_t seqno, Time delay, uint32_t retxCount, int32_t hopCount);
+  typedef void (*RetxCheckCallback)(Ptr<App> app);
 
 protected:
   // from App
@@ -131,6 +130,43 @@ protected:
   Time
   GetRetxTimer() const;
 
+  /**
+   * \brief Switches between periodic (every RetxTimer) and on-demand checks of retransmission
+   * timeouts
+   */
+  void
+  SetRetxTimerOnDemand(bool onDemand);
+
+  bool
+  GetRetxTimerOnDemand() const;
+
+  /**
+   * \brief (Re)schedules retransmission timeout check for the earliest outstanding deadline
+   *
+   * Used only in RetxTimerOnDemand mode
+   */
+  void
+  ScheduleRetxCheck();
+
+  /**
+   * \brief Get the next sequence number to be retransmitted (the smallest one)
+   * \return sequence number or std::numeric_limits<uint32_t>::max() if there is none
+   */
+  uint32_t
+  PopRetxSeq();
+
+  /**
+   * \brief Appends name component carrying the sequence number (sequence number marker by default)
+   */
+  virtual void
+  AppendSequenceNumber(Name& name, uint32_t seq) const;
+
+  /**
+   * \brief Extracts the sequence number from the last component of Interest or Data name
+   */
+  virtual uint32_t
+  GetSequenceNumber(const Name& name) const;
+
 protected:
   Ptr<UniformRandomVariable> m_rand; ///< @brief nonce generator
 
@@ -139,6 +175,7 @@ protected:
   EventId m_sendEvent; ///< @brief EventId of pending "send packet" event
   Time m_retxTimer;    ///< @brief Currently estimated retransmission timer
   EventId m_retxEvent; ///< @brief Event to check whether or not retransmission should be performed
+  bool m_retxTimerOnDemand; ///< @brief m_retxEvent is scheduled only for the earliest deadline
 
   Ptr<RttEstimator> m_rtt; ///< @brief RTT estimator
 
@@ -148,15 +185,7 @@ protected:
 
   /// @cond include_hidden
   /**
-   * \struct This struct contains sequence numbers of packets to be retransmitted
-   */
-  struct RetxSeqsContainer : public std::set<uint32_t> {
-  };
-
-  RetxSeqsContainer m_retxSeqs; ///< \brief ordered set of sequence numbers to be retransmitted
-
-  /**
-   * \struct This struct contains a pair of packet sequence number and its timeout
+   * \struct This struct contains a pair of packet sequence number and its transmission time
    */
   struct SeqTimeout {
     SeqTimeout(uint32_t _seq, Time _time)
@@ -168,46 +197,36 @@ protected:
     uint32_t seq;
     Time time;
   };
-  /// @endcond
-
-  /// @cond include_hidden
-  class i_seq {
-  };
-  class i_timestamp {
-  };
-  /// @endcond
 
-  /// @cond include_hidden
   /**
-   * \struct This struct contains a multi-index for the set of SeqTimeout structs
-   */
-  struct SeqTimeoutsContainer
-    : public boost::multi_index::
-        multi_index_container<SeqTimeout,
-                              boost::multi_index::
-                                indexed_by<boost::multi_index::
-                                             ordered_unique<boost::multi_index::tag<i_seq>,
-                                                            boost::multi_index::
-                                                              member<SeqTimeout, uint32_t,
-                                                                     &SeqTimeout::seq>>,
-                                           boost::multi_index::
-                                             ordered_non_unique<boost::multi_index::
-                                                                  tag<i_timestamp>,
-                                                                boost::multi_index::
-                                                                  member<SeqTimeout, Time,
-                                                                         &SeqTimeout::time>>>> {
-  };
+   * \brief Checks whether the entry no longer represents a pending timeout (Data received or
+   * the timeout already processed)
+   */
+  bool
+  IsStale(const SeqTimeout& entry);
 
-  SeqTimeoutsContainer m_seqTimeouts; ///< \brief multi-index for the set of SeqTimeout structs
+  SeqStateTable m_seqStates; ///< \brief state of outstanding sequence numbers
+
+  /**
+   * \brief Transmissions in the order of their time, checked by CheckRetxTimeout
+   *
+   * Entries are not removed when Data arrives; CheckRetxTimeout skips those that no longer match
+   * SeqState::timeoutSent
+   */
+  std::deque<SeqTimeout> m_seqTimeouts;
 
-  SeqTimeoutsContainer m_seqLastDelay;
-  SeqTimeoutsContainer m_seqFullDelay;
-  std::map<uint32_t, uint32_t> m_seqRetxCounts;
+  /**
+   * \brief Sequence numbers to be retransmitted, smallest first
+   *
+   * Entries without SeqState::pendingRetx flag are stale and skipped by PopRetxSeq
+   */
+  std::priority_queue<uint32_t, std::vector<uint32_t>, std::greater<uint32_t>> m_retxSeqs;
 
   TracedCallback<Ptr<App> /* app */, uint32_t /* seqno */, Time /* delay */, int32_t /*hop count*/>
     m_lastRetransmittedInterestDataDelay;
   TracedCallback<Ptr<App> /* app */, uint32_t /* seqno */, Time /* delay */,
                  uint32_t /*retx count*/, int32_t /*hop count*/> m_firstInterestDataDelay;
+  TracedCallback<Ptr<App> /* app */> m_retxCheck;
 
   /// @endcond
 };
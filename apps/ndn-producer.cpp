@@ -79,6 +79,9 @@ Producer::StartApplication()
   NS_LOG_FUNCTION_NOARGS();
   App::StartApplication();
 
+  m_dataTemplate.Set(*DataTemplate::MakeVirtualData(m_virtualPayloadSize, m_freshness, m_signature,
+                                                    m_keyLocator));
+
   FibHelper::AddRoute(GetNode(), m_prefix, m_face, 0);
 }
 
@@ -100,33 +103,11 @@ Producer::OnInterest(shared_ptr<const Interest> interest)
   if (!m_active)
     return;
 
-  Name dataName(interest->getName());
-  // dataName.append(m_postfix);
-  // dataName.appendVersion();
-
-  auto data = make_shared<Data>();
-  data->setName(dataName);
-  data->setFreshnessPeriod(::ndn::time::milliseconds(m_freshness.GetMilliSeconds()));
-
-  data->setContent(make_shared< ::ndn::Buffer>(m_virtualPayloadSize));
-
-  Signature signature;
-  SignatureInfo signatureInfo(static_cast< ::ndn::tlv::SignatureTypeValue>(255));
-
-  if (m_keyLocator.size() > 0) {
-    signatureInfo.setKeyLocator(m_keyLocator);
-  }
-
-  signature.setInfo(signatureInfo);
-  signature.setValue(::ndn::makeNonNegativeIntegerBlock(::ndn::tlv::SignatureValue, m_signature));
-
-  data->setSignature(signature);
+  // all fields except the name are pre-encoded at application start
+  shared_ptr<Data> data = m_dataTemplate.Instantiate(interest->getName());
 
   NS_LOG_INFO("node(" << GetNode()->GetId() << ") responding with Data: " << data->getName());
 
-  // to create real wire encoding
-  data->wireEncode();
-
   m_transmittedDatas(data, this, m_face);
   m_appLink->onReceiveData(*data);
 }
@@ -25,6 +25,8 @@
 #include "ndn-app.hpp"
 #include "ns3/ndnSIM/model/ndn-common.hpp"
 
+#include "ns3/ndnSIM/utils/ndn-data-template.hpp"
+
 #include "ns3/nstime.h"
 #include "ns3/ptr.h"
 
@@ -67,6 +69,8 @@ private:
 
   uint32_t m_signature;
   Name m_keyLocator;
+
+  DataTemplate m_dataTemplate; ///< @brief Data packet built from attributes at application start
 };
 
 } // namespace ndn
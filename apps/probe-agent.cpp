@@ -31,7 +31,9 @@
 
 #include "ndn-cxx/prodloc-info.hpp"
 
+#include <algorithm>
 #include <memory>
+#include <tuple>
 
 NS_LOG_COMPONENT_DEFINE("ndn.ProbeAgent");
 
@@ -40,6 +42,9 @@ namespace ndn {
 
 NS_OBJECT_ENSURE_REGISTERED(ProbeAgent);
 
+const std::string ProbeAgent::LIFETIME_MARKER = "lifetime=";
+const std::string ProbeAgent::NONCE_MARKER = "nonce=";
+
 TypeId
 ProbeAgent::GetTypeId(void)
 {
@@ -68,6 +73,8 @@ ProbeAgent::StartApplication()
   NS_LOG_FUNCTION_NOARGS();
   App::StartApplication();
 
+  m_ackTemplate.Set(*DataTemplate::MakeVirtualData(0, Seconds(0), 0, Name()));
+
   FibHelper::AddRoute(GetNode(), m_prefix, m_face, 0);
 }
 
@@ -81,9 +88,11 @@ ProbeAgent::StopApplication()
 
 /**
  * Receives an interest.
- * If it is an update request, update the locator for the prefix (/update/prefix/locator)
- * If it is a register request, register the locator for the prefix (/register/prefix/locator)
- * If it is an unregister request, unregister the locator for the prefix (/unregister/prefix)
+ * If it is a register or update request, (re)bind the locators to the prefixes and acknowledge
+ * with Data:
+ * /<agent>/register|update[/lifetime=<ms>][/nonce=<n>]/<prefix>/<locator>[/<prefix>/<locator>...]
+ * If it is an unregister request (/<agent>/unregister[/nonce=<n>]/<prefix>[/<prefix>...]), remove
+ * the bindings and acknowledge with Data
  * If it is an object request, pre-append the locator and forward it
  */
 void
@@ -97,25 +106,170 @@ ProbeAgent::OnInterest(shared_ptr<const Interest> interest)
   if (!m_active)
     return;
 
-  if (interest->getName().at(1).toUri() == "update") {
-    Update("/" + interest->getName().at(2).toUri(), "/" + interest->getName().at(3).toUri());
-  } else if (interest->getName().at(1).toUri() == "register") {
-    Register("/" + interest->getName().at(2).toUri(), "/" + interest->getName().at(3).toUri());
-  } else if (interest->getName().at(1).toUri() == "unregister") {
-    Unregister("/" + interest->getName().at(2).toUri());
-  } else {
-    string prefix = "/" + interest->getName().at(0).toUri();
-    shared_ptr<Name> forwardName = make_shared<Name>(m_prefixes[prefix]);
-    forwardName->append(interest->getName());
-
-    shared_ptr<Interest> forwardInterest = make_shared<Interest>();
-    forwardInterest->setNonce(interest->getNonce());
-    forwardInterest->setName(*forwardName);
-
-    m_transmittedInterests(forwardInterest, this, m_face);
-    m_appLink->onReceiveInterest(*forwardInterest);
-    NS_LOG_DEBUG("Node" << GetNode()->GetId() << " forwarding interest " << forwardName->toUri());
+  const Name& name = interest->getName();
+  if (name.size() > m_prefix.size() && m_prefix.isPrefixOf(name)) {
+    if (!ProcessCommand(name)) {
+      return;
+    }
+
+    shared_ptr<Data> ack = m_ackTemplate.Instantiate(name);
+    m_transmittedDatas(ack, this, m_face);
+    m_appLink->onReceiveData(*ack);
+    return;
+  }
+
+  const BindingTable::Binding* binding = m_bindings.FindLongestPrefixMatch(name);
+  while (binding != nullptr && binding->IsExpired(Simulator::Now())) {
+    Name expired = binding->prefix;
+    NS_LOG_DEBUG("Node" << GetNode()->GetId() << " binding for " << expired << " expired");
+    m_bindings.Erase(expired);
+    binding = m_bindings.FindLongestPrefixMatch(name);
+  }
+
+  if (binding == nullptr) {
+    NS_LOG_DEBUG("Node" << GetNode()->GetId() << " no binding for " << name);
+    return;
+  }
+
+  Name forwardName(binding->locator);
+  forwardName.append(name);
+
+  shared_ptr<Interest> forwardInterest = make_shared<Interest>();
+  forwardInterest->setNonce(interest->getNonce());
+  forwardInterest->setName(forwardName);
+
+  m_transmittedInterests(forwardInterest, this, m_face);
+  m_appLink->onReceiveInterest(*forwardInterest);
+  NS_LOG_DEBUG("Node" << GetNode()->GetId() << " forwarding interest " << forwardName);
+}
+
+void
+ProbeAgent::AppendCommandName(Name& command, const Name& name)
+{
+  const Block& wire = name.wireEncode();
+  command.append(wire.wire(), wire.size());
+}
+
+bool
+ProbeAgent::DecodeCommandName(const name::Component& component, Name& name)
+{
+  bool isOk = false;
+  Block block;
+  std::tie(isOk, block) = Block::fromBuffer(component.value(), component.value_size());
+
+  if (isOk && block.type() == tlv::Name && block.size() == component.value_size()) {
+    name.wireDecode(block);
+  }
+  else {
+    // one-component name of the older command format
+    name = Name().append(component);
+  }
+  return !name.empty();
+}
+
+name::Component
+ProbeAgent::MakeLifetimeComponent(Time lifetime)
+{
+  return name::Component(LIFETIME_MARKER + to_string(lifetime.GetMilliSeconds()));
+}
+
+bool
+ProbeAgent::ParseLifetimeComponent(const name::Component& component, Time& lifetime)
+{
+  std::string value(reinterpret_cast<const char*>(component.value()), component.value_size());
+  if (value.compare(0, LIFETIME_MARKER.size(), LIFETIME_MARKER) != 0)
+    return false;
+
+  std::string milliseconds = value.substr(LIFETIME_MARKER.size());
+  if (milliseconds.empty()
+      || milliseconds.find_first_not_of("0123456789") != std::string::npos)
+    return false;
+
+  lifetime = MilliSeconds(std::stoll(milliseconds));
+  return true;
+}
+
+name::Component
+ProbeAgent::MakeNonceComponent(uint32_t nonce)
+{
+  return name::Component(NONCE_MARKER + to_string(nonce));
+}
+
+bool
+ProbeAgent::IsNonceComponent(const name::Component& component)
+{
+  return component.value_size() > NONCE_MARKER.size()
+         && std::equal(NONCE_MARKER.begin(), NONCE_MARKER.end(), component.value());
+}
+
+bool
+ProbeAgent::ProcessCommand(const Name& name)
+{
+  static const name::Component UPDATE("update");
+  static const name::Component REGISTER("register");
+  static const name::Component UNREGISTER("unregister");
+
+  size_t pos = m_prefix.size();
+  const name::Component& command = name.get(pos++);
+
+  if (command == UNREGISTER) {
+    if (pos < name.size() && IsNonceComponent(name.get(pos))) {
+      ++pos;
+    }
+
+    std::vector<Name> prefixes(name.size() - pos);
+    for (size_t i = 0; i < prefixes.size(); ++i) {
+      if (!DecodeCommandName(name.get(pos + i), prefixes[i])) {
+        NS_LOG_DEBUG("Node" << GetNode()->GetId() << " malformed command " << name);
+        return false;
+      }
+    }
+
+    for (const Name& prefix : prefixes) {
+      m_bindings.Erase(prefix);
+      RemoveOrigin(prefix);
+    }
+    ndn::GlobalRoutingHelper::CalculateRoutes();
+    return true;
+  }
+
+  if (command != REGISTER && command != UPDATE) {
+    NS_LOG_DEBUG("Node" << GetNode()->GetId() << " unknown command " << command);
+    return false;
+  }
+
+  Time lifetime; // zero: binding does not expire
+  if (pos < name.size() && ParseLifetimeComponent(name.get(pos), lifetime)) {
+    ++pos;
   }
+  if (pos < name.size() && IsNonceComponent(name.get(pos))) {
+    ++pos;
+  }
+
+  // the whole command is validated before any binding is changed
+  std::vector<std::pair<Name, Name>> bindings((name.size() - pos) / 2);
+  bool isMalformed = bindings.empty() || (name.size() - pos) % 2 != 0;
+  for (size_t i = 0; !isMalformed && i < bindings.size(); ++i) {
+    isMalformed = !DecodeCommandName(name.get(pos + 2 * i), bindings[i].first)
+                  || !DecodeCommandName(name.get(pos + 2 * i + 1), bindings[i].second);
+  }
+  if (isMalformed) {
+    NS_LOG_DEBUG("Node" << GetNode()->GetId() << " malformed command " << name);
+    return false;
+  }
+
+  for (const auto& binding : bindings) {
+    InsertBinding(binding.first, binding.second, lifetime);
+    if (command == REGISTER) {
+      AddOrigin(binding.first);
+    }
+  }
+
+  if (command == REGISTER) {
+    // routes for the whole batch are calculated once
+    ndn::GlobalRoutingHelper::CalculateRoutes();
+  }
+  return true;
 }
 
 void
@@ -139,8 +293,6 @@ ProbeAgent::OnData(shared_ptr<const Data> data)
     }
   }
 
-  string prefix = data->getName().at(0).toUri();
-
   Name objectName(data->getName().getSubName(1));
   //objectName.append(to_string(hopCount));
   NS_LOG_DEBUG(objectName.toUri());
@@ -166,34 +318,55 @@ ProbeAgent::OnData(shared_ptr<const Data> data)
 }
 
 void
-ProbeAgent::Register(string prefix, string locator)
+ProbeAgent::InsertBinding(const Name& prefix, const Name& locator, Time lifetime)
 {
-  NS_LOG_FUNCTION_NOARGS();
-  m_prefixes[prefix] = locator;
-  ndn::GlobalRoutingHelper ndnGlobalRoutingHelper; 
-  ndnGlobalRoutingHelper.AddOrigin(prefix, GetNode());
+  Time expiry = lifetime.IsStrictlyPositive() ? Simulator::Now() + lifetime : Time::Max();
+  m_bindings.Insert(prefix, locator, expiry);
+  NS_LOG_INFO("Node" << GetNode()->GetId() << " binding " << prefix << " => " << locator
+                     << ", lifetime " << lifetime.As(Time::S));
+}
+
+void
+ProbeAgent::AddOrigin(const Name& prefix)
+{
+  ndn::GlobalRoutingHelper ndnGlobalRoutingHelper;
+  ndnGlobalRoutingHelper.AddOrigin(prefix.toUri(), GetNode());
   FibHelper::AddRoute(GetNode(), prefix, m_face, 0);
+}
+
+void
+ProbeAgent::RemoveOrigin(const Name& prefix)
+{
+//  ndn::GlobalRoutingHelper ndnGlobalRoutingHelper;
+//  ndnGlobalRoutingHelper.RemoveOrigin(prefix, GetNode());
+  FibHelper::RemoveRoute(GetNode(), prefix, m_face);
+}
+
+void
+ProbeAgent::Register(const Name& prefix, const Name& locator, Time lifetime)
+{
+  NS_LOG_FUNCTION_NOARGS();
+  InsertBinding(prefix, locator, lifetime);
+  AddOrigin(prefix);
   ndn::GlobalRoutingHelper::CalculateRoutes();
   //ndn::GlobalRoutingHelper::PrintFIBs();
   NS_LOG_INFO("Node" << GetNode()->GetId() << " registering " << prefix << " => " << locator);
 }
 
 void
-ProbeAgent::Update(string prefix, string locator)
+ProbeAgent::Update(const Name& prefix, const Name& locator, Time lifetime)
 {
   NS_LOG_FUNCTION_NOARGS();
-  m_prefixes[prefix] = locator;
+  InsertBinding(prefix, locator, lifetime);
   NS_LOG_INFO("Node" << GetNode()->GetId() << " updating " << prefix << " => " << locator);
 }
 
 void
-ProbeAgent::Unregister(string prefix)
+ProbeAgent::Unregister(const Name& prefix)
 {
   NS_LOG_FUNCTION_NOARGS();
-  m_prefixes.erase(prefix);
-  ndn::GlobalRoutingHelper ndnGlobalRoutingHelper;
-//  ndnGlobalRoutingHelper.RemoveOrigin(prefix, GetNode());
-  FibHelper::RemoveRoute(GetNode(), prefix, m_face);
+  m_bindings.Erase(prefix);
+  RemoveOrigin(prefix);
   ndn::GlobalRoutingHelper::CalculateRoutes();
   NS_LOG_DEBUG("Node" << GetNode()->GetId() << " unregistering " << prefix);
 }
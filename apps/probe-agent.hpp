@@ -33,8 +33,9 @@
 #include "ns3/ndnSIM/utils/ndn-fw-hop-count-tag.hpp"
 #include "helper/ndn-link-control-helper.hpp"
 #include <utils/ndn-catalog.hpp>
+#include <utils/ndn-binding-table.hpp>
+#include <utils/ndn-data-template.hpp>
 #include <vector>
-#include <map>
 
 #include "ndn-cxx/prodloc-info.hpp"
 
@@ -64,14 +65,65 @@ public:
   virtual void
   OnData(shared_ptr<const Data> data);
 
+  /**
+   * @brief Bind @p locator to @p prefix and announce the prefix from this node
+   * @param lifetime lifetime of the binding, zero if it does not expire
+   */
   virtual void
-  Register(string prefix, string locator);
+  Register(const Name& prefix, const Name& locator, Time lifetime = Time());
 
+  /**
+   * @brief Rebind @p prefix to a new @p locator (and extend lifetime of the binding)
+   */
   virtual void
-  Update(string prefix, string locator);
+  Update(const Name& prefix, const Name& locator, Time lifetime = Time());
 
   virtual void
-  Unregister(string prefix);
+  Unregister(const Name& prefix);
+
+  /**
+   * @brief Append @p name to @p command as a single (nested Name) component
+   */
+  static void
+  AppendCommandName(Name& command, const Name& name);
+
+  /**
+   * @brief Decode name appended by AppendCommandName
+   *
+   * A component that does not contain a nested Name is taken as a one-component name, as in the
+   * older command format
+   *
+   * @return false if the decoded name is empty
+   */
+  static bool
+  DecodeCommandName(const name::Component& component, Name& name);
+
+  /**
+   * @brief Make "lifetime=<ms>" component of register and update commands
+   */
+  static name::Component
+  MakeLifetimeComponent(Time lifetime);
+
+  /**
+   * @return false if @p component is not a lifetime component
+   */
+  static bool
+  ParseLifetimeComponent(const name::Component& component, Time& lifetime);
+
+  /**
+   * @brief Make "nonce=<n>" component, which makes names of repeated commands unique
+   *
+   * Without it a repeated command (binding refresh, or a move back to an earlier location)
+   * would have the same name as an earlier one and could be answered by a cached acknowledgment
+   */
+  static name::Component
+  MakeNonceComponent(uint32_t nonce);
+
+  static bool
+  IsNonceComponent(const name::Component& component);
+
+  static const std::string LIFETIME_MARKER; ///< @brief prefix of the lifetime component
+  static const std::string NONCE_MARKER;    ///< @brief prefix of the nonce component
 
 protected:
   // inherited from Application base class.
@@ -81,10 +133,34 @@ protected:
   virtual void
   StopApplication(); // Called at time specified by Stop
 
+  /**
+   * @brief Process (possibly batched) register, update, or unregister command
+   *
+   * /<agent>/register|update[/lifetime=<ms>][/nonce=<n>]/<prefix>/<locator>[/<prefix>/<locator>...]
+   * /<agent>/unregister[/nonce=<n>]/<prefix>[/<prefix>...]
+   *
+   * Each prefix and locator is a single component (see AppendCommandName)
+   *
+   * @return false if the name is not a command or the command is malformed (then none of
+   *         its bindings is applied)
+   */
+  bool
+  ProcessCommand(const Name& name);
+
+  void
+  InsertBinding(const Name& prefix, const Name& locator, Time lifetime);
+
+  void
+  AddOrigin(const Name& prefix);
+
+  void
+  RemoveOrigin(const Name& prefix);
+
 protected:
   Name m_prefix;
+  DataTemplate m_ackTemplate; ///< @brief empty Data acknowledging commands
 
-  map<string, string> m_prefixes;
+  BindingTable m_bindings; ///< @brief prefix => locator bindings of the mobile producers
 };
 
 } // namespace ndn
@@ -68,6 +68,22 @@ ProbeConsumer::GetTypeId(void)
                     UintegerValue(100), MakeUintegerAccessor(&ProbeConsumer::m_objects),
                     MakeUintegerChecker<uint32_t>())
 
+      .AddAttribute("LocatorCache", "Remember producer location reported in Data received through "
+                    "the home agent and send subsequent Interests directly to the locator, until "
+                    "the direct request fails",
+                    BooleanValue(false), MakeBooleanAccessor(&ProbeConsumer::m_locatorCache),
+                    MakeBooleanChecker())
+
+      .AddAttribute("LocatorPrefix", "Prefix of locator names (locator is prefix + loc<location>, "
+                    "the same component as ProbeProducer registers with the home agent)",
+                    StringValue("/"), MakeNameAccessor(&ProbeConsumer::m_locatorPrefix),
+                    MakeNameChecker())
+
+      .AddAttribute("LocatorCacheTimeout", "If Data for the direct request does not arrive within "
+                    "this time, the locator is forgotten and the request is sent to the home agent",
+                    StringValue("1s"), MakeTimeAccessor(&ProbeConsumer::m_locatorCacheTimeout),
+                    MakeTimeChecker())
+
       .AddAttribute("Global", "Global variables",
                     PointerValue(NULL), MakePointerAccessor(&ProbeConsumer::m_global),
                     MakePointerChecker<BinTreeGlobal>())
@@ -75,13 +91,20 @@ ProbeConsumer::GetTypeId(void)
       .AddTraceSource("PathStretch",
                       "Path stretch of requests",
                       MakeTraceSourceAccessor(&ProbeConsumer::m_pathStretch),
-                      "ns3::ndn::ProbeConsumer::PathStretchCallback");
+                      "ns3::ndn::ProbeConsumer::PathStretchCallback")
+
+      .AddTraceSource("PathStretchSample",
+                      "Path stretch of requests, without object name (see ndn::PathStretchTracer)",
+                      MakeTraceSourceAccessor(&ProbeConsumer::m_pathStretchSample),
+                      "ns3::ndn::ProbeConsumer::PathStretchSampleCallback");
 
   return tid;
 }
 
 ProbeConsumer::ProbeConsumer()
   : m_rand(CreateObject<UniformRandomVariable>())
+  , m_locatorCache(false)
+  , m_cachedLocation(0)
 {
   NS_LOG_FUNCTION_NOARGS();
 }
@@ -106,6 +129,10 @@ ProbeConsumer::StopApplication() // Called at time specified by Stop
 
   // cancel periodic packet generation
   Simulator::Cancel(m_sendEvent);
+  for (auto& request : m_directRequests) {
+    request.second.missEvent.Cancel();
+  }
+  m_directRequests.clear();
 
   // cleanup base stuff
   App::StopApplication();
@@ -120,21 +147,61 @@ ProbeConsumer::SendPacket()
   NS_LOG_FUNCTION_NOARGS();
 
   uint32_t objectID = m_rand->GetValue(0, m_objects);
-  shared_ptr<Name> objectName = make_shared<Name>(m_interestName);
-  objectName->append("/obj" + to_string(objectID));
+  m_requestedObject = m_interestName;
+  m_requestedObject.append("/obj" + to_string(objectID));
+
+  m_request = Simulator::Now();  
+
+  if (m_locatorCache && !m_cachedLocator.empty()) {
+    Name directName(m_cachedLocator);
+    directName.append(m_requestedObject);
+
+    // earlier requests for the same name are superseded, others stay outstanding
+    DirectRequest& request = m_directRequests[directName];
+    request.object = m_requestedObject;
+    request.missEvent.Cancel();
+    request.missEvent = Simulator::Schedule(m_locatorCacheTimeout, &ProbeConsumer::OnLocatorMiss,
+                                            this, directName);
+    SendInterest(directName);
+  }
+  else {
+    SendInterest(m_requestedObject);
+  }
+
+  ScheduleNextPacket();
+}
 
-  NS_LOG_DEBUG("Node" << GetNode()->GetId() << " sending interest " << objectName->toUri());
+void
+ProbeConsumer::SendInterest(const Name& name)
+{
+  NS_LOG_DEBUG("Node" << GetNode()->GetId() << " sending interest " << name);
 
   shared_ptr<Interest> interest = make_shared<Interest>();
   interest->setNonce(m_rand->GetValue(0, std::numeric_limits<uint32_t>::max()));
-  interest->setName(*objectName);
+  interest->setName(name);
 
   m_transmittedInterests(interest, this, m_face);
   m_appLink->onReceiveInterest(*interest);
+}
 
-  m_request = Simulator::Now();  
+void
+ProbeConsumer::OnLocatorMiss(Name directName)
+{
+  auto request = m_directRequests.find(directName);
+  if (!m_active || request == m_directRequests.end())
+    return;
 
-  ScheduleNextPacket();
+  Name object = request->second.object;
+  request->second.missEvent.Cancel();
+  m_directRequests.erase(request);
+
+  NS_LOG_DEBUG("Node" << GetNode()->GetId() << " direct request " << directName << " failed");
+  // the locator might have been replaced by a newer one in the meantime
+  if (!m_cachedLocator.empty() && m_cachedLocator.isPrefixOf(directName)) {
+    m_cachedLocator.clear();
+  }
+
+  SendInterest(object);
 }
 
 void
@@ -163,6 +230,13 @@ ProbeConsumer::OnData(shared_ptr<const Data> data)
   NS_LOG_FUNCTION_NOARGS();
   NS_LOG_DEBUG("Node" << GetNode()->GetId() << " receiving data " << data->getName());
 
+  auto request = m_directRequests.find(data->getName());
+  bool isDirect = request != m_directRequests.end();
+  if (isDirect) {
+    request->second.missEvent.Cancel();
+    m_directRequests.erase(request);
+  }
+
   //int hopCount = stoi(data->getName().at(-1));
   //uint32_t distHA_MP = stoi(data->getName().at(-1).toUri());
   uint32_t distHA_MP;
@@ -205,11 +279,28 @@ ProbeConsumer::OnData(shared_ptr<const Data> data)
   stretch = hopCount - sp;
 
   //m_pathStretch(this, data->getName(), hopCount, sp, stretch, distHA_MP, data->getName().at(-2).toUri(), Simulator::Now() - m_request); 
-  m_pathStretch(this, data->getName(), hopCount, sp, stretch, prodloc, data->getName().at(-2).toUri(), Simulator::Now() - m_request); 
+  m_pathStretch(this, data->getName(), hopCount, sp, stretch, prodloc,
+                data->getName().at(-2).toUri(), Simulator::Now() - m_request);
+  m_pathStretchSample(this, prodloc, hopCount, sp, stretch, Simulator::Now() - m_request, isDirect);
+
+  if (m_locatorCache && !isDirect && (m_cachedLocator.empty() || prodloc != m_cachedLocation)) {
+    // Data came through the home agent, ProdLocInfo tells the current producer location
+    // (locator is rebuilt only when the producer has moved)
+    m_cachedLocation = prodloc;
+    m_cachedLocator = Name(m_locatorPrefix).append("loc" + to_string(prodloc));
+  }
   //NS_LOG_INFO("Consumer" << GetNode()->GetId() << " hc: " << hopCount << " stretch: " << stretch << " shortest-path: " << sp << " dist(HA,MP): " << distHA_MP << " producer-location: " << data->getName().at(-2));
 
 }
 
+void
+ProbeConsumer::OnNack(shared_ptr<const lp::Nack> nack)
+{
+  App::OnNack(nack); // tracing inside
+
+  OnLocatorMiss(nack->getInterest().getName());
+}
+
 
 } // namespace ndn
 } // namespace ns3
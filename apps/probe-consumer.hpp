@@ -68,6 +68,10 @@ public:
   virtual void
   OnData(shared_ptr<const Data> data);
 
+  // From App
+  virtual void
+  OnNack(shared_ptr<const lp::Nack> nack);
+
   /**
    * @brief Actually send packet
    */
@@ -75,7 +79,13 @@ public:
   SendPacket();
 
 public:
-  //typedef void (*PathStretchCallback)(Ptr<App> app, Name object, int32_t hopCount, int32_t stretch, int32_t sp, int32_t distha_mp, string prodloc, Time delay);
+  typedef void (*PathStretchCallback)(Ptr<App> app, Name object, int32_t hopCount, int32_t sp,
+                                      int32_t stretch, int32_t prodloc, std::string locator,
+                                      Time delay);
+
+  typedef void (*PathStretchSampleCallback)(Ptr<App> app, uint32_t prodloc, int32_t hopCount,
+                                            int32_t sp, int32_t stretch, Time delay,
+                                            bool isDirect);
 
 protected:
   // from App
@@ -92,6 +102,16 @@ protected:
   virtual void
   ScheduleNextPacket();
 
+  void
+  SendInterest(const Name& name);
+
+  /**
+   * \brief Direct request @p directName failed (Nack or no Data within LocatorCacheTimeout):
+   * forget the locator, if it is still cached, and request the object through the home agent
+   */
+  void
+  OnLocatorMiss(Name directName);
+
 protected:
   Ptr<UniformRandomVariable> m_rand; ///< @brief nonce generator
   Ptr<BinTreeGlobal> m_global;
@@ -104,8 +124,30 @@ protected:
   double m_frequency; // Frequency of interest packets (in hertz)
   Name m_interestName;     ///< \brief NDN Name of the Interest (use Name)
 
+  /**
+   * \brief Outstanding request sent directly to a cached locator
+   */
+  struct DirectRequest
+  {
+    Name object;        ///< \brief requested object (without locator)
+    EventId missEvent;  ///< \brief fires if Data does not arrive within LocatorCacheTimeout
+  };
+
+  bool m_locatorCache;         ///< \brief send Interests directly to the last known locator
+  Name m_locatorPrefix;        ///< \brief locator is prefix + loc<location>
+  Time m_locatorCacheTimeout;  ///< \brief time to wait for Data of the direct request
+  Name m_cachedLocator;        ///< \brief empty if no locator is known
+  uint32_t m_cachedLocation;   ///< \brief producer location of m_cachedLocator
+  Name m_requestedObject;      ///< \brief name of the last requested object (without locator)
+  std::map<Name, DirectRequest> m_directRequests; ///< \brief by name of the direct Interest
+
   TracedCallback<Ptr<App>, Name, int32_t, int32_t, int32_t, int32_t, string, Time> m_pathStretch;
 
+  /// @brief Same as m_pathStretch, without per-Data name and string arguments
+  /// (app, producer location, hop count, shortest path, stretch, delay, whether Data was fetched
+  /// directly from the cached locator)
+  TracedCallback<Ptr<App>, uint32_t, int32_t, int32_t, int32_t, Time, bool> m_pathStretchSample;
+
   /// @endcond
 };
 
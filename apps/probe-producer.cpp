@@ -26,10 +26,15 @@
 
 #include "model/ndn-l3-protocol.hpp"
 #include "helper/ndn-fib-helper.hpp"
+#include "probe-agent.hpp"
 
 #include "ndn-cxx/prodloc-info.hpp"
 
+#include <algorithm>
+#include <map>
 #include <memory>
+#include <sstream>
+#include <tuple>
 
 using namespace std;
 
@@ -61,6 +66,35 @@ ProbeProducer::GetTypeId(void)
                     BooleanValue("true"), MakeBooleanAccessor(&ProbeProducer::m_homeAgent),
                     MakeBooleanChecker())
 
+      .AddAttribute("CoalesceRouteCalculation", "Request route recalculation on movement through "
+                    "GlobalRoutingHelper::RequestRouteCalculation, so that movements within the "
+                    "routing hold-down interval share a single recalculation",
+                    BooleanValue(false),
+                    MakeBooleanAccessor(&ProbeProducer::m_coalesceRouteCalculation),
+                    MakeBooleanChecker())
+
+      .AddAttribute("HomeAgents", "Space-separated prefixes of (replicated) home agents, the one "
+                    "responsible for the producer prefix is selected by consistent hashing",
+                    StringValue("/ha0"),
+                    MakeStringAccessor(&ProbeProducer::SetHomeAgents,
+                                       &ProbeProducer::GetHomeAgents),
+                    MakeStringChecker())
+
+      .AddAttribute("BindingLifetime", "Lifetime of the binding requested from the home agent, "
+                    "refreshed every half of the lifetime. If 0, the binding does not expire",
+                    TimeValue(Seconds(0)), MakeTimeAccessor(&ProbeProducer::m_bindingLifetime),
+                    MakeTimeChecker())
+
+      .AddAttribute("AckTimeout", "Retransmit register/update command if it is not acknowledged "
+                    "by the home agent within this time",
+                    TimeValue(Seconds(1)), MakeTimeAccessor(&ProbeProducer::m_ackTimeout),
+                    MakeTimeChecker())
+
+      .AddAttribute("UpdateBatchDelay", "Commands of producers on the same node to the same home "
+                    "agent issued within this delay are sent in a single Interest",
+                    TimeValue(Seconds(0)), MakeTimeAccessor(&ProbeProducer::m_batchDelay),
+                    MakeTimeChecker())
+
       .AddAttribute("Home", "Home location of the producer",
                     VectorValue(Vector(0, 0, 0)), MakeVectorAccessor(&ProbeProducer::m_home),
                     MakeVectorChecker())
@@ -110,7 +144,10 @@ ProbeProducer::StartApplication()
   Ptr<MobilityModel> mob = GetNode()->GetObject<MobilityModel>();
   mob->TraceConnectWithoutContext("CourseChange", MakeCallback(&ProbeProducer::CourseChange, this));
   m_location = m_home;
+  UpdateDataTemplate();
   if (m_homeAgent) {
+    NS_ABORT_MSG_IF(m_homeAgents.GetNReplicas() == 0, "No home agents configured");
+    m_homeAgentPrefix = m_homeAgents.GetReplica(m_prefix);
     Register();
   } else {
     FibHelper::AddRoute(GetNode(), m_prefix, m_face, 0);
@@ -122,9 +159,34 @@ ProbeProducer::StopApplication()
 {
   NS_LOG_FUNCTION_NOARGS();
 
+  m_refreshEvent.Cancel();
+  for (auto& pending : m_pendingCommands) {
+    pending.second.retxEvent.Cancel();
+  }
+  m_pendingCommands.clear();
+
   App::StopApplication();
 }
 
+void
+ProbeProducer::SetHomeAgents(const std::string& homeAgents)
+{
+  m_homeAgentsList = homeAgents;
+  m_homeAgents = ConsistentHashRing();
+
+  std::istringstream is(homeAgents);
+  std::string homeAgent;
+  while (is >> homeAgent) {
+    m_homeAgents.AddReplica(Name(homeAgent));
+  }
+}
+
+std::string
+ProbeProducer::GetHomeAgents() const
+{
+  return m_homeAgentsList;
+}
+
 void
 ProbeProducer::OnInterest(shared_ptr<const Interest> interest)
 {
@@ -135,43 +197,46 @@ ProbeProducer::OnInterest(shared_ptr<const Interest> interest)
 
   NS_LOG_FUNCTION_NOARGS();
 
-  Name dataName(interest->getName());
-  //dataName.append(to_string((int) m_location.x));
-  ProdLocInfo prodloc = ProdLocInfo();
-  prodloc.setLocation((int) m_location.x);
-
-  auto data = make_shared<Data>();
-  data->setName(dataName);
-  data->setProdLocInfo(prodloc);
-  data->setFreshnessPeriod(::ndn::time::milliseconds(m_freshness.GetMilliSeconds()));
+  // all fields except the name are pre-encoded when the location changes
+  shared_ptr<Data> data = m_dataTemplate.Instantiate(interest->getName());
 
-  data->setContent(make_shared< ::ndn::Buffer>(m_virtualPayloadSize));
+  NS_LOG_DEBUG("Node" << GetNode()->GetId() << " sending data packet " << data->getName() << " with location set to " << data->getProdLocInfo().getLocation());
 
-  Signature signature;
-  SignatureInfo signatureInfo(static_cast< ::ndn::tlv::SignatureTypeValue>(255));
+  m_transmittedDatas(data, this, m_face);
+  m_appLink->onReceiveData(*data);
 
-  if (m_keyLocator.size() > 0) {
-    signatureInfo.setKeyLocator(m_keyLocator);
-  }
+  //m_servedData(this, interest->getName());
+}
 
-  signature.setInfo(signatureInfo);
-  signature.setValue(::ndn::makeNonNegativeIntegerBlock(::ndn::tlv::SignatureValue, m_signature));
+void
+ProbeProducer::UpdateDataTemplate()
+{
+  ProdLocInfo prodloc = ProdLocInfo();
+  prodloc.setLocation((int) m_location.x);
 
-  data->setSignature(signature);
+  shared_ptr<Data> data = DataTemplate::MakeVirtualData(m_virtualPayloadSize, m_freshness,
+                                                        m_signature, m_keyLocator);
+  data->setProdLocInfo(prodloc);
 
-  NS_LOG_DEBUG("Node" << GetNode()->GetId() << " sending data packet " << data->getName() << " with location set to " << prodloc.getLocation());
+  m_dataTemplate.Set(*data);
+}
 
-  // to create real wire encoding
-  data->wireEncode();
+void
+ProbeProducer::OnData(shared_ptr<const Data> data)
+{
+  App::OnData(data); // tracing inside
 
-  m_transmittedDatas(data, this, m_face);
-  m_appLink->onReceiveData(*data);
+  auto pending = m_pendingCommands.find(data->getName());
+  if (pending == m_pendingCommands.end())
+    return;
 
-  //m_servedData(this, interest->getName());
+  NS_LOG_DEBUG("Node" << GetNode()->GetId() << " command acknowledged " << data->getName());
+  pending->second.retxEvent.Cancel();
+  m_pendingCommands.erase(pending);
 }
 
 void
-ProbeProducer::SendInterest(string name)
+ProbeProducer::SendInterest(const Name& name, bool mustBeFresh)
 {
   if (!m_active)
     return;
@@ -183,6 +248,7 @@ ProbeProducer::SendInterest(string name)
   shared_ptr<Interest> interest = make_shared<Interest>();
   interest->setNonce(m_rand->GetValue(0, std::numeric_limits<uint32_t>::max()));
   interest->setName(*objectName);
+  interest->setMustBeFresh(mustBeFresh);
   
   m_transmittedInterests(interest, this, m_face);
   m_appLink->onReceiveInterest(*interest);
@@ -196,7 +262,7 @@ ProbeProducer::Register()
   NS_LOG_FUNCTION_NOARGS();
   FibHelper::AddRoute(GetNode(), "/loc" + to_string((int) m_home.x) + m_prefix.toUri(), m_face, 0);
 
-  SendInterest("/ha0/register" + m_prefix.toUri() + "/loc" + to_string((int) m_home.x));
+  SendBindingCommand("register");
 }
 
 void
@@ -204,7 +270,7 @@ ProbeProducer::UpdateLocation()
 {
   NS_LOG_FUNCTION_NOARGS();
   FibHelper::AddRoute(GetNode(), "/loc" + to_string((int) m_location.x) + m_prefix.toUri(), m_face, 0);
-  SendInterest("/ha0/update" + m_prefix.toUri() + "/loc" + to_string((int) m_location.x));
+  SendBindingCommand("update");
 }
 
 void
@@ -218,6 +284,7 @@ ProbeProducer::CourseChange(Ptr<const MobilityModel> model)
   }
 
   m_location = model->GetPosition();
+  UpdateDataTemplate();
   router = m_routers->getRouters()[(int) m_location.x];
   ndn::LinkControlHelper::UpLink(router, GetNode());
   if (m_homeAgent) {
@@ -226,14 +293,142 @@ ProbeProducer::CourseChange(Ptr<const MobilityModel> model)
 
   NS_LOG_INFO("Producer" << GetNode()->GetId() << " new position " << m_location.x);
 
-  uint32_t changes = ndn::GlobalRoutingHelper::CalculateRoutes();
-  m_FIBChanges(this, m_prefix, changes);
+  if (m_coalesceRouteCalculation) {
+    ndn::GlobalRoutingHelper::RequestRouteCalculation(m_prefix,
+      MakeCallback(&ProbeProducer::OnRoutesCalculated, this));
+  }
+  else {
+    OnRoutesCalculated(ndn::GlobalRoutingHelper::CalculateRoutes());
+  }
   //ndn::GlobalRoutingHelper::PrintFIBs();
   
   if (m_homeAgent) {
-    SendInterest("/ha0/update" + m_prefix.toUri() + "/loc" + to_string((int) m_location.x));
+    SendBindingCommand("update");
   }
 }
 
+void
+ProbeProducer::OnRoutesCalculated(uint32_t changes)
+{
+  NS_LOG_FUNCTION(this << changes);
+  m_FIBChanges(this, m_prefix, changes);
+}
+
+/// @cond include_hidden
+typedef std::tuple<uint32_t /* node */, Name /* home agent */, std::string /* command */,
+                   Time /* lifetime */> CommandBatchKey;
+
+/**
+ * @brief Producers waiting for the batched command to be sent
+ */
+static std::map<CommandBatchKey, std::vector<Ptr<ProbeProducer>>> g_commandBatches;
+static bool g_isClearScheduled = false;
+
+/**
+ * @brief Release the producers when the simulator is destroyed (node IDs are reused by the
+ *        next simulation)
+ */
+static void
+clearCommandBatches()
+{
+  g_commandBatches.clear();
+  g_isClearScheduled = false;
+}
+/// @endcond
+
+void
+ProbeProducer::SendBindingCommand(const std::string& command)
+{
+  NS_LOG_FUNCTION(command);
+
+  CommandBatchKey key(GetNode()->GetId(), m_homeAgentPrefix, command, m_bindingLifetime);
+  if (!g_isClearScheduled) {
+    Simulator::ScheduleDestroy(&clearCommandBatches);
+    g_isClearScheduled = true;
+  }
+
+  std::vector<Ptr<ProbeProducer>>& batch = g_commandBatches[key];
+  if (batch.empty()) {
+    Simulator::Schedule(m_batchDelay, &ProbeProducer::FlushCommandBatch, GetNode()->GetId(),
+                        m_homeAgentPrefix, command, m_bindingLifetime);
+  }
+  if (std::find(batch.begin(), batch.end(), this) == batch.end()) {
+    batch.push_back(this);
+  }
+
+  if (m_bindingLifetime.IsStrictlyPositive()) {
+    m_refreshEvent.Cancel();
+    m_refreshEvent = Simulator::Schedule(Seconds(m_bindingLifetime.GetSeconds() / 2),
+                                         &ProbeProducer::SendBindingCommand, this, "update");
+  }
+}
+
+void
+ProbeProducer::FlushCommandBatch(uint32_t nodeId, Name homeAgent, std::string command,
+                                 Time lifetime)
+{
+  auto batch = g_commandBatches.find(CommandBatchKey(nodeId, homeAgent, command, lifetime));
+  if (batch == g_commandBatches.end())
+    return;
+
+  std::vector<Ptr<ProbeProducer>> producers;
+  producers.swap(batch->second);
+  g_commandBatches.erase(batch);
+
+  // the first active producer sends the command on behalf of all and waits for the acknowledgment
+  for (const auto& producer : producers) {
+    if (producer->m_active) {
+      producer->SendCommand(command, producers);
+      return;
+    }
+  }
+}
+
+void
+ProbeProducer::SendCommand(const std::string& command,
+                           const std::vector<Ptr<ProbeProducer>>& producers)
+{
+  if (!m_active)
+    return;
+
+  Name name(m_homeAgentPrefix);
+  name.append(command);
+  if (m_bindingLifetime.IsStrictlyPositive()) {
+    name.append(ProbeAgent::MakeLifetimeComponent(m_bindingLifetime));
+  }
+  // repeated commands must not be answered by a cached acknowledgment
+  uint32_t nonce = m_rand->GetValue(0, std::numeric_limits<uint32_t>::max());
+  name.append(ProbeAgent::MakeNonceComponent(nonce));
+  for (const auto& producer : producers) {
+    ProbeAgent::AppendCommandName(name, producer->m_prefix);
+    ProbeAgent::AppendCommandName(name, Name("loc" + to_string((int) producer->m_location.x)));
+  }
+
+  PendingCommand& pending = m_pendingCommands[name];
+  pending.command = command;
+  pending.producers = producers;
+  pending.retxEvent.Cancel();
+  pending.retxEvent = Simulator::Schedule(m_ackTimeout, &ProbeProducer::OnCommandTimeout, this,
+                                          name);
+
+  SendInterest(name, true);
+}
+
+void
+ProbeProducer::OnCommandTimeout(Name name)
+{
+  auto pending = m_pendingCommands.find(name);
+  if (pending == m_pendingCommands.end())
+    return;
+
+  NS_LOG_DEBUG("Node" << GetNode()->GetId() << " command not acknowledged " << name);
+  std::string command = pending->second.command;
+  std::vector<Ptr<ProbeProducer>> producers = pending->second.producers;
+  m_pendingCommands.erase(pending);
+
+  // locations might have changed in the meantime, the command is rebuilt
+  SendCommand(command, producers);
+}
+
 } // namespace ndn
 } // namespace ns3
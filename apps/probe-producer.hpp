@@ -32,6 +32,9 @@
 
 #include "helper/ndn-link-control-helper.hpp"
 #include <utils/ndn-catalog.hpp>
+#include <utils/ndn-data-template.hpp>
+#include <utils/ndn-consistent-hash-ring.hpp>
+#include <map>
 #include <vector>
 
 #include "ndn-cxx/prodloc-info.hpp"
@@ -59,6 +62,13 @@ public:
   virtual void
   OnInterest(shared_ptr<const Interest> interest);
 
+  virtual void
+  OnData(shared_ptr<const Data> data);
+
+public:
+  typedef void (*ServedDataCallback)(Ptr<App> app, Name object);
+  typedef void (*FIBChangesCallback)(Ptr<App> app, Name prefix, uint32_t changes);
+
 protected:
   // inherited from Application base class.
   virtual void
@@ -67,8 +77,11 @@ protected:
   virtual void
   StopApplication(); // Called at time specified by Stop
 
+  /**
+   * @param mustBeFresh set for commands, which are acknowledged by Data with zero freshness
+   */
   void
-  SendInterest(string name);
+  SendInterest(const Name& name, bool mustBeFresh = false);
 
   void
   Register();
@@ -79,6 +92,45 @@ protected:
   void
   CourseChange(Ptr<const MobilityModel> model);
 
+  /**
+   * @brief Report FIB changes of a (coalesced) route calculation requested on movement
+   */
+  void
+  OnRoutesCalculated(uint32_t changes);
+
+  /**
+   * @brief Re-encode Data template for the current location
+   */
+  void
+  UpdateDataTemplate();
+
+  void
+  SetHomeAgents(const std::string& homeAgents);
+
+  std::string
+  GetHomeAgents() const;
+
+  /**
+   * @brief Queue register or update command for the home agent
+   *
+   * Commands of all producers on the node for the same home agent are batched for
+   * UpdateBatchDelay and sent as a single Interest
+   */
+  void
+  SendBindingCommand(const std::string& command);
+
+  static void
+  FlushCommandBatch(uint32_t nodeId, Name homeAgent, std::string command, Time lifetime);
+
+  /**
+   * @brief Send command with bindings of @p producers and wait for acknowledgment
+   */
+  void
+  SendCommand(const std::string& command, const std::vector<Ptr<ProbeProducer>>& producers);
+
+  void
+  OnCommandTimeout(Name name);
+
 protected:
   Ptr<UniformRandomVariable> m_rand; ///< @brief nonce generator
   Name m_prefix;
@@ -87,12 +139,33 @@ protected:
   uint32_t m_virtualPayloadSize;
   Time m_freshness;
   bool m_homeAgent;
+  bool m_coalesceRouteCalculation;
 
   uint32_t m_signature;
   Name m_keyLocator;
 
   Ptr<Catalog> m_routers;
 
+  DataTemplate m_dataTemplate; ///< @brief Data packet with ProdLocInfo of the current location
+
+  std::string m_homeAgentsList;
+  ConsistentHashRing m_homeAgents;
+  Name m_homeAgentPrefix; ///< @brief home agent responsible for m_prefix
+  Time m_bindingLifetime;
+  Time m_ackTimeout;
+  Time m_batchDelay;
+  EventId m_refreshEvent;
+
+  /// @cond include_hidden
+  struct PendingCommand {
+    std::string command;
+    std::vector<Ptr<ProbeProducer>> producers;
+    EventId retxEvent;
+  };
+  /// @endcond
+
+  std::map<Name, PendingCommand> m_pendingCommands; ///< @brief commands waiting for acknowledgment
+
   TracedCallback<Ptr<App>, Name> m_servedData;
   TracedCallback<Ptr<App>, Name, uint32_t> m_FIBChanges;
 };
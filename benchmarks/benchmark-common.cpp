@@ -0,0 +1,179 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "benchmark-common.hpp"
+
+#include "ns3/ndnSIM/model/ndn-global-router.hpp"
+#include "ns3/ndnSIM/utils/topology/topology-generator.hpp"
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <iostream>
+
+#include "ns3/ndnSIM/utils/mem-usage.hpp"
+
+NS_LOG_COMPONENT_DEFINE("ndn.Benchmarks");
+
+namespace ns3 {
+namespace ndn {
+namespace bench {
+
+std::map<std::string, Runner::Benchmark>&
+Runner::GetBenchmarks()
+{
+  static std::map<std::string, Benchmark> benchmarks;
+  return benchmarks;
+}
+
+int
+Runner::Register(const std::string& name, const Benchmark& benchmark)
+{
+  GetBenchmarks()[name] = benchmark;
+  return 0;
+}
+
+Runner::Runner(const Options& options)
+  : m_options(options)
+{
+}
+
+void
+Runner::run(const std::string& filter)
+{
+  for (const auto& benchmark : GetBenchmarks()) {
+    if (benchmark.first.compare(0, filter.size(), filter) != 0) {
+      continue;
+    }
+
+    NS_LOG_INFO("Running " << benchmark.first);
+    m_current = benchmark.first;
+    benchmark.second(*this);
+    ResetSimulation();
+  }
+  m_current.clear();
+}
+
+void
+Runner::report(const std::string& name, uint64_t size, double wallTime, uint64_t events)
+{
+  Result result;
+  result.benchmark = m_current;
+  result.name = name;
+  result.size = size;
+  result.wallTime = wallTime;
+  result.events = events;
+  result.rss = MemUsage::Get();
+  result.peakRss = GetPeakRss();
+
+  NS_LOG_INFO(m_current << "/" << name << " [" << size << "]: " << wallTime << "s, "
+              << (wallTime > 0 ? events / wallTime : 0) << " events/s");
+
+  m_results.push_back(result);
+}
+
+static std::string
+escape(const std::string& value)
+{
+  std::string escaped;
+  for (char c : value) {
+    if (c == '"' || c == '\\') {
+      escaped += '\\';
+    }
+    escaped += c;
+  }
+  return escaped;
+}
+
+void
+Runner::writeJson(std::ostream& os, const std::string& label) const
+{
+  os << "{\n"
+     << "  \"label\": \"" << escape(label) << "\",\n"
+     << "  \"results\": [";
+
+  bool isFirst = true;
+  for (const Result& result : m_results) {
+    os << (isFirst ? "\n" : ",\n");
+    isFirst = false;
+
+    os << "    {"
+       << "\"benchmark\": \"" << escape(result.benchmark) << "\", "
+       << "\"name\": \"" << escape(result.name) << "\", "
+       << "\"size\": " << result.size << ", "
+       << "\"wall_time_s\": " << result.wallTime << ", "
+       << "\"events\": " << result.events << ", "
+       << "\"events_per_sec\": " << (result.wallTime > 0 ? result.events / result.wallTime : 0)
+       << ", "
+       << "\"rss_bytes\": " << result.rss << ", "
+       << "\"peak_rss_bytes\": " << result.peakRss << "}";
+  }
+
+  os << "\n  ]\n"
+     << "}\n";
+}
+
+std::vector<uint64_t>
+Runner::getSizes(uint32_t minScale, uint32_t maxScale) const
+{
+  std::vector<uint64_t> sizes;
+  uint64_t size = 1;
+  for (uint32_t scale = 0; scale <= std::min(maxScale, m_options.maxScale); ++scale) {
+    if (scale >= minScale) {
+      sizes.push_back(size);
+    }
+    size *= 10;
+  }
+  return sizes;
+}
+
+int64_t
+GetPeakRss()
+{
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return -1;
+  }
+
+#if defined(__APPLE__)
+  return usage.ru_maxrss; // bytes
+#else
+  return static_cast<int64_t>(usage.ru_maxrss) * 1024; // kilobytes
+#endif
+}
+
+NodeContainer
+CreateGrid(uint32_t n)
+{
+  TopologyGenerator generator;
+  return generator.CreateGrid(n, n);
+}
+
+void
+ResetSimulation()
+{
+  Simulator::Destroy();
+  Names::Clear();
+  GlobalRouter::clear();
+}
+
+} // namespace bench
+} // namespace ndn
+} // namespace ns3
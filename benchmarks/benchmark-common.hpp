@@ -0,0 +1,165 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDNSIM_BENCHMARKS_BENCHMARK_COMMON_HPP
+#define NDNSIM_BENCHMARKS_BENCHMARK_COMMON_HPP
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+
+#include <chrono>
+#include <functional>
+#include <iosfwd>
+#include <limits>
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+namespace bench {
+
+/**
+ * @brief Single measurement
+ */
+struct Result {
+  std::string benchmark;
+  std::string name;
+  uint64_t size;
+  double wallTime; ///< seconds
+  uint64_t events;
+  int64_t rss;     ///< bytes, after the measurement
+  int64_t peakRss; ///< bytes, process-wide high-water mark
+};
+
+struct Options {
+  uint32_t maxScale = 6;
+  std::string rocketfuel;
+};
+
+/**
+ * @brief Registry of benchmarks and collector of their results
+ */
+class Runner {
+public:
+  typedef std::function<void(Runner&)> Benchmark;
+
+  /**
+   * @brief Register benchmark (to be used through NDNSIM_BENCHMARK macro)
+   */
+  static int
+  Register(const std::string& name, const Benchmark& benchmark);
+
+  explicit Runner(const Options& options);
+
+  const Options&
+  getOptions() const
+  {
+    return m_options;
+  }
+
+  /**
+   * @brief Run all registered benchmarks, names of which start with @p filter
+   */
+  void
+  run(const std::string& filter);
+
+  /**
+   * @brief Record result of the measurement within the currently running benchmark
+   */
+  void
+  report(const std::string& name, uint64_t size, double wallTime, uint64_t events);
+
+  void
+  writeJson(std::ostream& os, const std::string& label) const;
+
+  /**
+   * @brief Get problem sizes 10^minScale .. 10^maxScale (maxScale from options)
+   */
+  std::vector<uint64_t>
+  getSizes(uint32_t minScale, uint32_t maxScale = std::numeric_limits<uint32_t>::max()) const;
+
+private:
+  static std::map<std::string, Benchmark>&
+  GetBenchmarks();
+
+private:
+  Options m_options;
+  std::string m_current;
+  std::list<Result> m_results;
+};
+
+/**
+ * @brief Wall-clock stopwatch
+ */
+class Stopwatch {
+public:
+  Stopwatch()
+    : m_start(std::chrono::steady_clock::now())
+  {
+  }
+
+  /**
+   * @brief Seconds since the construction
+   */
+  double
+  elapsed() const
+  {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - m_start).count();
+  }
+
+private:
+  std::chrono::steady_clock::time_point m_start;
+};
+
+/**
+ * @brief Get peak resident set size of the process in bytes
+ */
+int64_t
+GetPeakRss();
+
+/**
+ * @brief Create n x n grid of nodes connected with point-to-point links
+ */
+NodeContainer
+CreateGrid(uint32_t n);
+
+/**
+ * @brief Destroy simulator, nodes, names, and global routing state between measurements
+ */
+void
+ResetSimulation();
+
+} // namespace bench
+} // namespace ndn
+} // namespace ns3
+
+#define NDNSIM_BENCHMARK_CONCAT_(a, b) a##b
+#define NDNSIM_BENCHMARK_CONCAT(a, b) NDNSIM_BENCHMARK_CONCAT_(a, b)
+
+/**
+ * @brief Register function void(Runner&) as benchmark with the specified name
+ */
+#define NDNSIM_BENCHMARK(name, function)                                                           \
+  static int NDNSIM_BENCHMARK_CONCAT(g_benchmarkRegistration, __LINE__) =                          \
+    ::ns3::ndn::bench::Runner::Register(name, function)
+
+#endif // NDNSIM_BENCHMARKS_BENCHMARK_COMMON_HPP
@@ -0,0 +1,92 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "benchmark-common.hpp"
+
+#include "ns3/ndnSIM/utils/ndn-binding-table.hpp"
+
+#include "ns3/random-variable-stream.h"
+
+#include <map>
+
+namespace ns3 {
+namespace ndn {
+namespace bench {
+
+/**
+ * Home agent indirection of 10^6 Interests with 10^3 .. 10^6 producer bindings: string-keyed
+ * map with URI conversions (the former ProbeAgent::OnInterest) versus BindingTable
+ */
+static void
+benchmarkBindingTable(Runner& runner)
+{
+  const uint64_t nInterests = 1000000;
+
+  for (uint64_t size : runner.getSizes(3)) {
+    Ptr<UniformRandomVariable> rng = CreateObject<UniformRandomVariable>();
+    std::vector<Name> interests;
+    interests.reserve(nInterests);
+    for (uint64_t i = 0; i < nInterests; ++i) {
+      uint32_t producer = rng->GetInteger(0, size - 1);
+      interests.push_back(Name("/prod" + std::to_string(producer)).appendSequenceNumber(i));
+    }
+
+    {
+      std::map<std::string, std::string> prefixes;
+      Stopwatch stopwatch;
+      for (uint64_t i = 0; i < size; ++i) {
+        prefixes["/prod" + std::to_string(i)] = "/loc" + std::to_string(i % 100);
+      }
+
+      size_t checksum = 0;
+      for (const Name& name : interests) {
+        std::string prefix = "/" + name.at(0).toUri();
+        Name forwardName(prefixes[prefix]);
+        forwardName.append(name);
+        checksum += forwardName.size();
+      }
+      runner.report("string-map", size, stopwatch.elapsed(), nInterests);
+      NS_ABORT_MSG_IF(checksum != 3 * nInterests, "Invalid indirection");
+    }
+
+    {
+      BindingTable bindings;
+      Stopwatch stopwatch;
+      for (uint64_t i = 0; i < size; ++i) {
+        bindings.Insert(Name("/prod" + std::to_string(i)), Name("/loc" + std::to_string(i % 100)));
+      }
+
+      size_t checksum = 0;
+      for (const Name& name : interests) {
+        const BindingTable::Binding* binding = bindings.FindLongestPrefixMatch(name);
+        Name forwardName(binding->locator);
+        forwardName.append(name);
+        checksum += forwardName.size();
+      }
+      runner.report("binding-table", size, stopwatch.elapsed(), nInterests);
+      NS_ABORT_MSG_IF(checksum != 3 * nInterests, "Invalid indirection");
+    }
+  }
+}
+
+NDNSIM_BENCHMARK("binding-table", benchmarkBindingTable);
+
+} // namespace bench
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,94 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "benchmark-common.hpp"
+
+#include "ns3/ndnSIM/model/ndn-block-header.hpp"
+
+#include <ndn-cxx/data.hpp>
+#include <ndn-cxx/interest.hpp>
+
+namespace ns3 {
+namespace ndn {
+namespace bench {
+
+static void
+measureBlockHeader(Runner& runner, const std::string& name, const Block& block, uint64_t count)
+{
+  nfd::face::Transport::Packet packet{Block(block)};
+  std::vector<Ptr<ns3::Packet>> packets;
+  packets.reserve(count);
+
+  {
+    Stopwatch stopwatch;
+    for (uint64_t i = 0; i < count; ++i) {
+      BlockHeader header(packet);
+      Ptr<ns3::Packet> ns3Packet = Create<ns3::Packet>();
+      ns3Packet->AddHeader(header);
+      packets.push_back(ns3Packet);
+    }
+    runner.report(name + "/encode", count, stopwatch.elapsed(), count);
+  }
+
+  {
+    Stopwatch stopwatch;
+    uint64_t nBytes = 0;
+    for (const auto& ns3Packet : packets) {
+      Ptr<ns3::Packet> copy = ns3Packet->Copy();
+      BlockHeader header;
+      copy->RemoveHeader(header);
+      nBytes += header.getBlock().size();
+    }
+    runner.report(name + "/decode", count, stopwatch.elapsed(), count);
+    NS_ABORT_MSG_IF(nBytes != count * block.size(), "Decoded blocks have unexpected size");
+  }
+}
+
+/**
+ * Encoding of Interest and Data packets of several sizes into ns3::Packet (BlockHeader) and
+ * decoding them back
+ */
+static void
+benchmarkBlockHeader(Runner& runner)
+{
+  for (uint64_t count : runner.getSizes(5, 5)) {
+    Interest interest(Name("/bench/block-header/interest").appendSequenceNumber(1));
+    interest.setNonce(1);
+    measureBlockHeader(runner, "interest", interest.wireEncode(), count);
+
+    for (size_t payloadSize : {100, 1024, 4096}) {
+      Data data(Name("/bench/block-header/data").appendSequenceNumber(1));
+      data.setContent(make_shared< ::ndn::Buffer>(payloadSize));
+
+      Signature signature;
+      SignatureInfo signatureInfo(static_cast< ::ndn::tlv::SignatureTypeValue>(255));
+      signature.setInfo(signatureInfo);
+      signature.setValue(::ndn::makeNonNegativeIntegerBlock(::ndn::tlv::SignatureValue, 0));
+      data.setSignature(signature);
+
+      measureBlockHeader(runner, "data-" + std::to_string(payloadSize), data.wireEncode(), count);
+    }
+  }
+}
+
+NDNSIM_BENCHMARK("block-header", benchmarkBlockHeader);
+
+} // namespace bench
+} // namespace ndn
+} // namespace ns3
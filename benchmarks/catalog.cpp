@@ -0,0 +1,101 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "benchmark-common.hpp"
+
+#include "ns3/ndnSIM/utils/ndn-catalog.hpp"
+
+namespace ns3 {
+namespace ndn {
+namespace bench {
+
+/**
+ * Catalog::addObject and Catalog::getObjectProperties throughput with integer object ids
+ * (10^4 .. 10^7 objects) and with object names (up to 10^6 objects)
+ */
+static void
+benchmarkCatalog(Runner& runner)
+{
+  for (uint64_t size : runner.getSizes(4, 7)) {
+    Ptr<Catalog> catalog = CreateObject<Catalog>();
+    catalog->setUserPopulationSize(size);
+    catalog->setPopularity(0.8, 100);
+    catalog->setObjectPopularityVariation(0.1);
+    catalog->setObjectSize(1024, 100);
+    catalog->initializeCatalog();
+
+    {
+      Stopwatch stopwatch;
+      catalog->reserveObjects(size);
+      for (uint32_t id = 0; id < size; ++id) {
+        catalog->addObject(id, catalog->getUserPopularity());
+      }
+      runner.report("id/add", size, stopwatch.elapsed(), size);
+    }
+
+    {
+      Stopwatch stopwatch;
+      double total = 0;
+      for (uint32_t id = 0; id < size; ++id) {
+        total += catalog->getObjectProperties(id).size;
+      }
+      runner.report("id/get", size, stopwatch.elapsed(), size);
+      NS_ABORT_MSG_IF(total <= 0, "Catalog lost objects");
+    }
+
+    if (size > 1000000) {
+      continue;
+    }
+
+    std::vector<Name> names;
+    names.reserve(size);
+    for (uint32_t id = 0; id < size; ++id) {
+      names.push_back(Name("/bench/catalog").appendNumber(id));
+    }
+
+    Ptr<Catalog> namedCatalog = CreateObject<Catalog>();
+    namedCatalog->setObjectPopularityVariation(0.1);
+    namedCatalog->setObjectSize(1024, 100);
+    namedCatalog->initializeCatalog();
+
+    {
+      Stopwatch stopwatch;
+      for (const Name& name : names) {
+        namedCatalog->addObject(name, 1.0);
+      }
+      runner.report("name/add", size, stopwatch.elapsed(), size);
+    }
+
+    {
+      Stopwatch stopwatch;
+      double total = 0;
+      for (const Name& name : names) {
+        total += namedCatalog->getObjectProperties(name).size;
+      }
+      runner.report("name/get", size, stopwatch.elapsed(), size);
+      NS_ABORT_MSG_IF(total <= 0, "Catalog lost objects");
+    }
+  }
+}
+
+NDNSIM_BENCHMARK("catalog", benchmarkCatalog);
+
+} // namespace bench
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,167 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "benchmark-common.hpp"
+
+#include "ns3/ndnSIM-module.h"
+
+namespace ns3 {
+namespace ndn {
+namespace bench {
+
+static void
+countInterest(uint64_t* counter, shared_ptr<const Interest>, Ptr<App>, shared_ptr<Face>)
+{
+  ++*counter;
+}
+
+static void
+countRetxCheck(uint64_t* counter, Ptr<App>)
+{
+  ++*counter;
+}
+
+/**
+ * Interests per second (wall clock) of a single consumer application requesting from a producer
+ * two hops away, with 10^3 .. 10^5 Interests per simulated second.  Measures per-Interest cost
+ * of consumer bookkeeping (sequence state, retransmission timers) together with forwarding.
+ */
+static void
+benchmarkConsumer(Runner& runner)
+{
+  for (const std::string type : {"Cbr", "Window"}) {
+    for (uint64_t rate : runner.getSizes(3, 5)) {
+      Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("100Gbps"));
+      Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("1ms"));
+      Config::SetDefault("ns3::DropTailQueue::MaxPackets", StringValue("100000"));
+
+      NodeContainer nodes = CreateGrid(2);
+
+      StackHelper ndnHelper;
+      ndnHelper.setCsSize(1);
+      ndnHelper.InstallAll();
+
+      GlobalRoutingHelper routingHelper;
+      routingHelper.InstallAll();
+
+      AppHelper consumerHelper("ns3::ndn::Consumer" + type);
+      consumerHelper.SetPrefix("/bench/consumer");
+      if (type == "Cbr") {
+        consumerHelper.SetAttribute("Frequency", StringValue(std::to_string(rate)));
+      }
+      else {
+        // enough in flight to sustain the rate with ~4ms RTT
+        consumerHelper.SetAttribute("Window", StringValue(std::to_string(rate / 100)));
+      }
+      ApplicationContainer consumers = consumerHelper.Install(nodes.Get(0));
+
+      AppHelper producerHelper("ns3::ndn::Producer");
+      producerHelper.SetPrefix("/bench/consumer");
+      producerHelper.SetAttribute("PayloadSize", StringValue("100"));
+      producerHelper.Install(nodes.Get(3));
+
+      routingHelper.AddOrigins("/bench/consumer", nodes.Get(3));
+      GlobalRoutingHelper::CalculateRoutes();
+
+      uint64_t nInterests = 0;
+      consumers.Get(0)->TraceConnectWithoutContext("TransmittedInterests",
+                                                   MakeBoundCallback(&countInterest, &nInterests));
+
+      Simulator::Stop(Seconds(10.0));
+
+      Stopwatch stopwatch;
+      Simulator::Run();
+      runner.report(type, rate, stopwatch.elapsed(), nInterests);
+
+      ResetSimulation();
+    }
+  }
+}
+
+NDNSIM_BENCHMARK("consumer", benchmarkConsumer);
+
+/**
+ * Population of 10^2 .. 10^4 mostly idle consumers (10 Interests each over 100 simulated
+ * seconds), with periodic and on-demand retransmission timers.  With the periodic timer each
+ * consumer schedules 2000 timer events regardless of activity, so the difference in wall-clock
+ * time is the cost of the timer events.  "-checks" results report the number of fired
+ * retransmission timer checks instead of the transmitted Interests.
+ */
+static void
+benchmarkConsumerPopulation(Runner& runner)
+{
+  for (const bool onDemand : {false, true}) {
+    for (uint64_t size : runner.getSizes(2, 4)) {
+      Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("100Gbps"));
+      Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("1ms"));
+      Config::SetDefault("ns3::DropTailQueue::MaxPackets", StringValue("100000"));
+
+      NodeContainer nodes = CreateGrid(2);
+
+      StackHelper ndnHelper;
+      ndnHelper.setCsSize(1);
+      ndnHelper.InstallAll();
+
+      GlobalRoutingHelper routingHelper;
+      routingHelper.InstallAll();
+
+      AppHelper consumerHelper("ns3::ndn::ConsumerCbr");
+      consumerHelper.SetPrefix("/bench/population");
+      consumerHelper.SetAttribute("Frequency", StringValue("0.1"));
+      consumerHelper.SetAttribute("MaxSeq", IntegerValue(10));
+      consumerHelper.SetAttribute("RetxTimerOnDemand", BooleanValue(onDemand));
+
+      uint64_t nInterests = 0;
+      uint64_t nRetxChecks = 0;
+      for (uint64_t i = 0; i < size; ++i) {
+        Ptr<Application> consumer = consumerHelper.Install(nodes.Get(i % 3)).Get(0);
+        consumer->TraceConnectWithoutContext("TransmittedInterests",
+                                             MakeBoundCallback(&countInterest, &nInterests));
+        consumer->TraceConnectWithoutContext("RetxCheck",
+                                             MakeBoundCallback(&countRetxCheck, &nRetxChecks));
+      }
+
+      AppHelper producerHelper("ns3::ndn::Producer");
+      producerHelper.SetPrefix("/bench/population");
+      producerHelper.SetAttribute("PayloadSize", StringValue("100"));
+      producerHelper.Install(nodes.Get(3));
+
+      routingHelper.AddOrigins("/bench/population", nodes.Get(3));
+      GlobalRoutingHelper::CalculateRoutes();
+
+      Simulator::Stop(Seconds(100.0));
+
+      Stopwatch stopwatch;
+      Simulator::Run();
+      double wallTime = stopwatch.elapsed();
+
+      std::string mode = onDemand ? "on-demand-retx" : "periodic-retx";
+      runner.report(mode, size, wallTime, nInterests);
+      runner.report(mode + "-checks", size, wallTime, nRetxChecks);
+
+      ResetSimulation();
+    }
+  }
+}
+
+NDNSIM_BENCHMARK("consumer-population", benchmarkConsumerPopulation);
+
+} // namespace bench
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,92 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "benchmark-common.hpp"
+
+#include "ns3/ndnSIM/model/cs/ndn-content-store.hpp"
+
+#include <ndn-cxx/data.hpp>
+#include <ndn-cxx/interest.hpp>
+
+namespace ns3 {
+namespace ndn {
+namespace bench {
+
+/**
+ * Insert, lookup (hits), and insert with eviction on a full old-style content store, separately
+ * for each replacement policy
+ */
+static void
+benchmarkContentStore(Runner& runner)
+{
+  for (const std::string policy : {"Lru", "Random", "Fifo", "Lfu"}) {
+    for (uint64_t size : runner.getSizes(3, 5)) {
+      std::vector<shared_ptr<const Data>> data;
+      std::vector<shared_ptr<const Interest>> interests;
+      data.reserve(2 * size);
+      interests.reserve(size);
+      for (uint64_t i = 0; i < 2 * size; ++i) {
+        Name name("/bench/cs");
+        name.appendSequenceNumber(i);
+        data.push_back(make_shared<Data>(name));
+        if (i < size) {
+          interests.push_back(make_shared<Interest>(name));
+        }
+      }
+
+      ObjectFactory factory("ns3::ndn::cs::" + policy);
+      factory.Set("MaxSize", StringValue(std::to_string(size)));
+      Ptr<ContentStore> cs = factory.Create<ContentStore>();
+
+      {
+        Stopwatch stopwatch;
+        for (uint64_t i = 0; i < size; ++i) {
+          cs->Add(data[i]);
+        }
+        runner.report(policy + "/insert", size, stopwatch.elapsed(), size);
+      }
+
+      {
+        Stopwatch stopwatch;
+        uint64_t nHits = 0;
+        for (const auto& interest : interests) {
+          if (cs->Lookup(interest) != nullptr) {
+            ++nHits;
+          }
+        }
+        runner.report(policy + "/lookup", size, stopwatch.elapsed(), size);
+        NS_ABORT_MSG_IF(nHits != size, "Unexpected cache misses");
+      }
+
+      {
+        Stopwatch stopwatch;
+        for (uint64_t i = size; i < 2 * size; ++i) {
+          cs->Add(data[i]);
+        }
+        runner.report(policy + "/evict", size, stopwatch.elapsed(), size);
+      }
+    }
+  }
+}
+
+NDNSIM_BENCHMARK("cs", benchmarkContentStore);
+
+} // namespace bench
+} // namespace ndn
+} // namespace ns3
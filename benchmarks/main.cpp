@@ -0,0 +1,78 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "benchmark-common.hpp"
+
+#include <fstream>
+#include <iostream>
+
+namespace ns3 {
+namespace ndn {
+namespace bench {
+
+/**
+ * Scalability benchmark suite for ndnSIM.  See benchmarks/README.md for the list of benchmarks
+ * and supported parameters:
+ *
+ *     ./waf --run "ndnSIM-benchmarks --filter=trie --max-scale=7 --output=trie.json"
+ */
+int
+main(int argc, char* argv[])
+{
+  Options options;
+  std::string filter;
+  std::string label;
+  std::string output = "-";
+
+  CommandLine cmd;
+  cmd.AddValue("filter", "Run only benchmarks with names starting with this prefix", filter);
+  cmd.AddValue("max-scale", "Largest problem size is 10^max-scale", options.maxScale);
+  cmd.AddValue("rocketfuel", "Rocketfuel map file (.cch) for the routing benchmark",
+               options.rocketfuel);
+  cmd.AddValue("label", "Label (e.g., version) to record in the results", label);
+  cmd.AddValue("output", "Output JSON file (- for standard output)", output);
+  cmd.Parse(argc, argv);
+
+  Runner runner(options);
+  runner.run(filter);
+
+  if (output == "-") {
+    runner.writeJson(std::cout, label);
+  }
+  else {
+    std::ofstream os(output.c_str(), std::ios_base::out | std::ios_base::trunc);
+    if (!os.is_open()) {
+      std::cerr << "File " << output << " cannot be opened for writing" << std::endl;
+      return 1;
+    }
+    runner.writeJson(os, label);
+  }
+
+  return 0;
+}
+
+} // namespace bench
+} // namespace ndn
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  return ns3::ndn::bench::main(argc, argv);
+}
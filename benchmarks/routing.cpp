@@ -0,0 +1,102 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "benchmark-common.hpp"
+
+#include "ns3/ndnSIM-module.h"
+
+namespace ns3 {
+namespace ndn {
+namespace bench {
+
+static const uint32_t N_ORIGINS = 10;
+
+static void
+measureRouting(Runner& runner, const std::string& name, const NodeContainer& nodes)
+{
+  {
+    Stopwatch stopwatch;
+    StackHelper ndnHelper;
+    ndnHelper.InstallAll();
+    runner.report(name + "/stack-install", nodes.GetN(), stopwatch.elapsed(), nodes.GetN());
+  }
+
+  GlobalRoutingHelper routingHelper;
+  routingHelper.InstallAll();
+
+  uint32_t step = std::max<uint32_t>(1, nodes.GetN() / N_ORIGINS);
+  for (uint32_t i = 0; i < nodes.GetN(); i += step) {
+    routingHelper.AddOrigin("/bench/routing/" + std::to_string(i), nodes.Get(i));
+  }
+
+  {
+    Stopwatch stopwatch;
+    GlobalRoutingHelper::CalculateRoutes();
+    // one shortest-path tree per node
+    runner.report(name + "/calculate-routes", nodes.GetN(), stopwatch.elapsed(), nodes.GetN());
+  }
+
+  ResetSimulation();
+}
+
+/**
+ * Stack installation and global route computation on grid topologies of increasing size
+ * (and on a Rocketfuel map, if specified with --rocketfuel)
+ */
+static void
+benchmarkRouting(Runner& runner)
+{
+  for (uint32_t side : {4, 8, 16, 32, 64}) {
+    if (side * side > runner.getSizes(0).back()) {
+      break;
+    }
+
+    measureRouting(runner, "grid", CreateGrid(side));
+  }
+
+  if (!runner.getOptions().rocketfuel.empty()) {
+    RocketfuelParams params;
+    params.averageRtt = 2;
+    params.clientNodeDegrees = 2;
+    params.minb2bBandwidth = "40Mbps";
+    params.minb2bDelay = "5ms";
+    params.maxb2bBandwidth = "100Mbps";
+    params.maxb2bDelay = "10ms";
+    params.minb2gBandwidth = "10Mbps";
+    params.minb2gDelay = "5ms";
+    params.maxb2gBandwidth = "20Mbps";
+    params.maxb2gDelay = "10ms";
+    params.ming2cBandwidth = "1Mbps";
+    params.ming2cDelay = "70ms";
+    params.maxg2cBandwidth = "3Mbps";
+    params.maxg2cDelay = "10ms";
+
+    RocketfuelMapReader reader;
+    reader.SetFileName(runner.getOptions().rocketfuel);
+    NodeContainer nodes = reader.Read(params, true, true);
+
+    measureRouting(runner, "rocketfuel", nodes);
+  }
+}
+
+NDNSIM_BENCHMARK("routing", benchmarkRouting);
+
+} // namespace bench
+} // namespace ndn
+} // namespace ns3
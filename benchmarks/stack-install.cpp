@@ -0,0 +1,78 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "benchmark-common.hpp"
+
+#include "ns3/ndnSIM-module.h"
+#include "ns3/ndnSIM/utils/mem-usage.hpp"
+
+NS_LOG_COMPONENT_DEFINE("ndn.Benchmarks.StackInstall");
+
+namespace ns3 {
+namespace ndn {
+namespace bench {
+
+static void
+measureStackInstall(Runner& runner, const std::string& name, bool isBare)
+{
+  for (uint32_t side : {10, 32, 100, 316}) {
+    if (side * side > runner.getSizes(0).back()) {
+      break;
+    }
+
+    NodeContainer nodes = CreateGrid(side);
+
+    int64_t rssBefore = MemUsage::Get();
+    Stopwatch stopwatch;
+
+    StackHelper ndnHelper;
+    if (isBare) {
+      ndnHelper.disableManagement();
+    }
+    ndnHelper.InstallAll();
+    // let RIB managers of the full stack be initialized (scheduled at time 0)
+    Simulator::Stop(Seconds(0));
+    Simulator::Run();
+
+    double wallTime = stopwatch.elapsed();
+    NS_LOG_INFO(name << " [" << nodes.GetN() << "]: "
+                << (MemUsage::Get() - rssBefore) / nodes.GetN() << " bytes per node");
+
+    runner.report(name, nodes.GetN(), wallTime, nodes.GetN());
+
+    ResetSimulation();
+  }
+}
+
+/**
+ * NDN stack installation on grid topologies (10^2 up to 10^5 nodes) with full NFD management
+ * and with the bare forwarder
+ */
+static void
+benchmarkStackInstall(Runner& runner)
+{
+  measureStackInstall(runner, "full", false);
+  measureStackInstall(runner, "bare", true);
+}
+
+NDNSIM_BENCHMARK("stack-install", benchmarkStackInstall);
+
+} // namespace bench
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,172 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "benchmark-common.hpp"
+
+#include "ns3/ndnSIM/utils/topology/annotated-topology-reader.hpp"
+
+#include "ns3/random-variable-stream.h"
+
+#include <boost/filesystem.hpp>
+
+#include <fstream>
+#include <set>
+#include <sstream>
+
+namespace ns3 {
+namespace ndn {
+namespace bench {
+
+/**
+ * @brief Exposes parsing stage of AnnotatedTopologyReader
+ */
+class ParsingTopologyReader : public AnnotatedTopologyReader {
+public:
+  using AnnotatedTopologyReader::NodeRecord;
+  using AnnotatedTopologyReader::LinkRecord;
+  using AnnotatedTopologyReader::ParseFile;
+};
+
+/**
+ * @brief Write annotated topology with @p nLinks random links between nLinks / 4 nodes
+ */
+static void
+writeTopology(const std::string& file, uint64_t nLinks)
+{
+  uint64_t nNodes = std::max<uint64_t>(nLinks / 4, 2);
+  Ptr<UniformRandomVariable> rng = CreateObject<UniformRandomVariable>();
+
+  std::ofstream os(file.c_str());
+  os << "router\n\n"
+     << "# node  comment  yPos  xPos\n";
+  for (uint64_t i = 0; i < nNodes; ++i) {
+    os << "node-" << i << "\tNA\t" << rng->GetInteger(1, 1000) << "\t" << rng->GetInteger(1, 1000)
+       << "\n";
+  }
+
+  os << "link\n\n"
+     << "# srcNode  dstNode  bandwidth  metric  delay  queue\n";
+  for (uint64_t i = 0; i < nLinks; ++i) {
+    uint32_t from = rng->GetInteger(0, nNodes - 1);
+    uint32_t to = (from + rng->GetInteger(1, nNodes - 1)) % nNodes;
+    os << "node-" << from << "\tnode-" << to << "\t10Mbps\t1\t" << rng->GetInteger(1, 50)
+       << "ms\t20\n";
+  }
+}
+
+/**
+ * @brief Parse the file the way AnnotatedTopologyReader::Read did before the memory-mapped
+ *        tokenizer (getline + istringstream, map of sets for duplicates, ordered name lookup)
+ */
+static uint64_t
+parseWithStreams(const std::string& file)
+{
+  std::ifstream topgen(file.c_str());
+  std::string line;
+  while (std::getline(topgen, line) && line != "router") {
+  }
+
+  std::map<std::string, uint32_t> index;
+  while (std::getline(topgen, line) && line != "link") {
+    if (line.empty() || line[0] == '#')
+      continue;
+
+    std::istringstream lineBuffer(line);
+    std::string name, city;
+    double latitude = 0, longitude = 0;
+    uint32_t systemId = 0;
+    lineBuffer >> name >> city >> latitude >> longitude >> systemId;
+    index.insert(std::make_pair(name, index.size()));
+  }
+
+  std::map<std::string, std::set<std::string>> processedLinks;
+  uint64_t nLinks = 0;
+  while (std::getline(topgen, line)) {
+    if (line.empty() || line[0] == '#')
+      continue;
+
+    std::istringstream lineBuffer(line);
+    std::string from, to, capacity, metric, delay, maxPackets, lossRate;
+    lineBuffer >> from >> to >> capacity >> metric >> delay >> maxPackets >> lossRate;
+
+    if (processedLinks[to].size() != 0
+        && processedLinks[to].find(from) != processedLinks[to].end()) {
+      continue; // duplicated link
+    }
+    processedLinks[from].insert(to);
+
+    NS_ABORT_MSG_IF(index.find(from) == index.end() || index.find(to) == index.end(),
+                    "Unknown node");
+    nLinks++;
+  }
+  return nLinks;
+}
+
+/**
+ * Annotated topology files with 10^4 up to 10^6 random links: parsing with streams (the former
+ * reader) versus the memory-mapped tokenizer, and complete Read() including creation of nodes
+ * and point-to-point links (up to 10^5 links)
+ */
+static void
+benchmarkTopologyReader(Runner& runner)
+{
+  boost::filesystem::path file =
+    boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("topo-%%%%%%.txt");
+
+  for (uint64_t size : runner.getSizes(4, 6)) {
+    writeTopology(file.string(), size);
+
+    uint64_t nLinks = 0;
+    {
+      Stopwatch stopwatch;
+      nLinks = parseWithStreams(file.string());
+      runner.report("streams", size, stopwatch.elapsed(), nLinks);
+    }
+
+    {
+      ParsingTopologyReader reader;
+      reader.SetFileName(file.string());
+
+      std::vector<ParsingTopologyReader::NodeRecord> nodes;
+      std::vector<ParsingTopologyReader::LinkRecord> links;
+      Stopwatch stopwatch;
+      reader.ParseFile(nodes, links);
+      runner.report("mmap", size, stopwatch.elapsed(), links.size());
+      NS_ABORT_MSG_IF(links.size() != nLinks, "Parsers disagree on the number of links");
+    }
+
+    if (size <= 100000) {
+      Stopwatch stopwatch;
+      AnnotatedTopologyReader reader;
+      reader.SetFileName(file.string());
+      reader.Read();
+      runner.report("read", size, stopwatch.elapsed(), reader.LinksSize());
+
+      ResetSimulation();
+    }
+  }
+
+  boost::filesystem::remove(file);
+}
+
+NDNSIM_BENCHMARK("topology-reader", benchmarkTopologyReader);
+
+} // namespace bench
+} // namespace ndn
+} // namespace ns3
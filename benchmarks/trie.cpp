@@ -0,0 +1,102 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "benchmark-common.hpp"
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+#include "ns3/ndnSIM/utils/trie/trie-with-policy.hpp"
+#include "ns3/ndnSIM/utils/trie/empty-policy.hpp"
+
+namespace ns3 {
+namespace ndn {
+namespace bench {
+
+typedef ndnSIM::trie_with_policy<Name, ndnSIM::non_pointer_traits<uint64_t>,
+                                 ndnSIM::empty_policy_traits> Trie;
+
+/**
+ * Insert, exact match, longest prefix match, and erase on the name trie with 10^4 .. 10^7 names
+ * (10^7 requires --max-scale=7 and several GB of memory)
+ */
+static void
+benchmarkTrie(Runner& runner)
+{
+  for (uint64_t size : runner.getSizes(4, 7)) {
+    std::vector<Name> names;
+    names.reserve(size);
+    for (uint64_t i = 0; i < size; ++i) {
+      names.push_back(Name("/bench/trie").appendNumber(i % 1000).appendNumber(i));
+    }
+
+    Trie trie;
+
+    {
+      Stopwatch stopwatch;
+      for (uint64_t i = 0; i < size; ++i) {
+        trie.insert(names[i], i + 1); // 0 is an empty payload
+      }
+      runner.report("insert", size, stopwatch.elapsed(), size);
+    }
+
+    {
+      Stopwatch stopwatch;
+      uint64_t nFound = 0;
+      for (const Name& name : names) {
+        if (trie.find_exact(name) != trie.end()) {
+          ++nFound;
+        }
+      }
+      runner.report("find-exact", size, stopwatch.elapsed(), size);
+      NS_ABORT_MSG_IF(nFound != size, "Trie lost some names");
+    }
+
+    std::vector<Name> longerNames;
+    longerNames.reserve(size);
+    for (const Name& name : names) {
+      longerNames.push_back(Name(name).append("suffix"));
+    }
+
+    {
+      Stopwatch stopwatch;
+      uint64_t nFound = 0;
+      for (const Name& name : longerNames) {
+        if (trie.longest_prefix_match(name) != trie.end()) {
+          ++nFound;
+        }
+      }
+      runner.report("longest-prefix-match", size, stopwatch.elapsed(), size);
+      NS_ABORT_MSG_IF(nFound != size, "Trie lost some names");
+    }
+    longerNames.clear();
+
+    {
+      Stopwatch stopwatch;
+      for (const Name& name : names) {
+        trie.erase(name);
+      }
+      runner.report("erase", size, stopwatch.elapsed(), size);
+    }
+  }
+}
+
+NDNSIM_BENCHMARK("trie", benchmarkTrie);
+
+} // namespace bench
+} // namespace ndn
+} // namespace ns3
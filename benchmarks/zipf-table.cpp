@@ -0,0 +1,74 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "benchmark-common.hpp"
+
+#include "ns3/ndnSIM/utils/ndn-zipf-table.hpp"
+
+#include "ns3/random-variable-stream.h"
+
+#include <limits>
+
+namespace ns3 {
+namespace ndn {
+namespace bench {
+
+/**
+ * Build time and per-sample cost of Zipf-Mandelbrot sampling tables (binary search and alias)
+ * for catalogs of 10^4 .. 10^7 objects
+ */
+static void
+benchmarkZipfTable(Runner& runner)
+{
+  const uint64_t nSamples = 1000000;
+
+  Ptr<UniformRandomVariable> rng = CreateObject<UniformRandomVariable>();
+  std::vector<double> samples(nSamples);
+  for (double& sample : samples) {
+    sample = rng->GetValue(std::numeric_limits<double>::min(), 1.0);
+  }
+
+  for (const auto& method : {std::make_pair(std::string("binary-search"), ZipfTable::BINARY_SEARCH),
+                             std::make_pair(std::string("alias"), ZipfTable::ALIAS)}) {
+    for (uint64_t size : runner.getSizes(4, 7)) {
+      shared_ptr<ZipfTable> table;
+      {
+        Stopwatch stopwatch;
+        table = make_shared<ZipfTable>(size, 0.7, 0.7, method.second);
+        runner.report(method.first + "/build", size, stopwatch.elapsed(), size);
+      }
+
+      {
+        Stopwatch stopwatch;
+        uint64_t checksum = 0;
+        for (double sample : samples) {
+          checksum += table->Sample(sample);
+        }
+        runner.report(method.first + "/sample", size, stopwatch.elapsed(), nSamples);
+        NS_ABORT_MSG_IF(checksum < nSamples, "Invalid rank sampled");
+      }
+    }
+  }
+}
+
+NDNSIM_BENCHMARK("zipf-table", benchmarkZipfTable);
+
+} // namespace bench
+} // namespace ndn
+} // namespace ns3
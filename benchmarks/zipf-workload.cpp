@@ -0,0 +1,107 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "benchmark-common.hpp"
+
+#include "ns3/ndnSIM-module.h"
+
+namespace ns3 {
+namespace ndn {
+namespace bench {
+
+static void
+countInterest(uint64_t* counter, const Interest&, const Face&)
+{
+  ++*counter;
+}
+
+static void
+countData(uint64_t* counter, const Data&, const Face&)
+{
+  ++*counter;
+}
+
+/**
+ * End-to-end simulation: Zipf-Mandelbrot consumers on the first row of a grid, single producer
+ * in the opposite corner, LRU caches on all nodes.  Events are Interest and Data packets
+ * received by forwarders.
+ */
+static void
+benchmarkZipfWorkload(Runner& runner)
+{
+  for (uint32_t side : {4, 8, 16}) {
+    if (side * side > runner.getSizes(0).back()) {
+      break;
+    }
+
+    Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("10Mbps"));
+    Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("1ms"));
+    Config::SetDefault("ns3::DropTailQueue::MaxPackets", StringValue("100"));
+
+    NodeContainer nodes = CreateGrid(side);
+
+    StackHelper ndnHelper;
+    ndnHelper.setCsSize(100);
+    ndnHelper.InstallAll();
+
+    GlobalRoutingHelper routingHelper;
+    routingHelper.InstallAll();
+
+    Ptr<Node> producer = nodes.Get(side * side - 1);
+    NodeContainer consumers;
+    for (uint32_t column = 0; column < side; ++column) {
+      consumers.Add(nodes.Get(column));
+    }
+
+    AppHelper consumerHelper("ns3::ndn::ConsumerZipfMandelbrot");
+    consumerHelper.SetPrefix("/bench/zipf");
+    consumerHelper.SetAttribute("Frequency", StringValue("100"));
+    consumerHelper.SetAttribute("NumberOfContents", StringValue("1000"));
+    consumerHelper.Install(consumers);
+
+    AppHelper producerHelper("ns3::ndn::Producer");
+    producerHelper.SetPrefix("/bench/zipf");
+    producerHelper.SetAttribute("PayloadSize", StringValue("1024"));
+    producerHelper.Install(producer);
+
+    routingHelper.AddOrigins("/bench/zipf", producer);
+    GlobalRoutingHelper::CalculateRoutes();
+
+    uint64_t nPackets = 0;
+    for (uint32_t i = 0; i < nodes.GetN(); ++i) {
+      Ptr<L3Protocol> l3 = nodes.Get(i)->GetObject<L3Protocol>();
+      l3->TraceConnectWithoutContext("InInterests", MakeBoundCallback(&countInterest, &nPackets));
+      l3->TraceConnectWithoutContext("InData", MakeBoundCallback(&countData, &nPackets));
+    }
+
+    Simulator::Stop(Seconds(10.0));
+
+    Stopwatch stopwatch;
+    Simulator::Run();
+    runner.report("grid", nodes.GetN(), stopwatch.elapsed(), nPackets);
+
+    ResetSimulation();
+  }
+}
+
+NDNSIM_BENCHMARK("zipf", benchmarkZipfWorkload);
+
+} // namespace bench
+} // namespace ndn
+} // namespace ns3
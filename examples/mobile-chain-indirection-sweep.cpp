@@ -0,0 +1,203 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+// mobile-chain-indirection-sweep.cpp
+//
+// Same scenario as mobile-chain-indirection.cpp, but runs all combinations of cache sizes,
+// numbers of objects, and request rates from a single template simulation (topology, stacks,
+// and routes are set up only once), e.g.:
+//
+//     ./waf --run="mobile-chain-indirection-sweep --n=10 --ha=0 --cs=10,100 --obj=100,1000
+//                  --req=1,5"
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/mobility-module.h"
+#include <ns3/ndnSIM/utils/ndn-catalog.hpp>
+#include "ns3/ndnSIM/helper/ndn-link-control-helper.hpp"
+
+#include <boost/algorithm/string.hpp>
+
+using namespace std;
+
+namespace ns3 {
+
+static vector<string>
+SplitValues(const string& values)
+{
+  vector<string> result;
+  boost::split(result, values, boost::is_any_of(","));
+  return result;
+}
+
+int
+main(int argc, char* argv[])
+{
+  // setting default parameters for PointToPoint links and channels
+  Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("1Mbps"));
+  Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("10ms"));
+  Config::SetDefault("ns3::DropTailQueue::MaxPackets", StringValue("100"));
+
+  uint32_t n = 10;
+  uint32_t ha = 0;
+  string obj = "100";
+  string cs = "100";
+  string req = "1";
+  bool locatorCache = false;
+  uint32_t processes = 0;
+  string output = "chain-indirection-sweep.dat";
+
+  CommandLine cmd;
+  cmd.AddValue("n", "number of nodes", n);
+  cmd.AddValue("ha", "home agent position", ha);
+  cmd.AddValue("obj", "comma-separated numbers of objects", obj);
+  cmd.AddValue("cs", "comma-separated cache sizes", cs);
+  cmd.AddValue("req", "comma-separated numbers of requisitions per object", req);
+  cmd.AddValue("locatorCache", "consumers send Interests directly to the last known producer "
+               "locator instead of through the home agent", locatorCache);
+  cmd.AddValue("processes", "maximum number of concurrent runs (0 for number of cores)",
+               processes);
+  cmd.AddValue("output", "file with app delays of all runs", output);
+  cmd.Parse(argc, argv);
+
+  // Setting simulation time
+  double simulation_time = 30000.0 / (n-1);
+
+  // Template: everything that does not depend on the swept parameters
+
+  NodeContainer nodes;
+  nodes.Create(n);
+
+  NodeContainer consumers;
+  for (uint32_t i = 0; i < n-1; i++) {
+    consumers.Add(nodes.Get(i));
+  }
+  Ptr<Node> producer = nodes.Get(n-1);
+  Ptr<Node> homeagent = nodes.Get(ha);
+
+  PointToPointHelper p2p;
+  Ptr<ns3::ndn::Catalog> catalog = Create<ns3::ndn::Catalog>();
+  for (uint32_t i = 0; i < consumers.GetN()-1; i++) {
+    p2p.Install(consumers.Get(i), consumers.Get(i+1));
+  }
+
+  for (uint32_t i = 0; i < consumers.GetN(); i++) {
+    p2p.Install(consumers.Get(i), producer);
+    catalog->addRouter(nodes.Get(i));
+  }
+
+  // Cache size is set for each run
+  ndn::StackHelper ndnHelper;
+  ndnHelper.SetOldContentStore("ns3::ndn::cs::Stats::Lru");
+  ndnHelper.SetDefaultRoutes(false);
+  ndnHelper.InstallAll();
+
+  Ptr<RandomVariableStream> indexes = CreateObject<UniformRandomVariable>();
+  indexes->SetAttribute("Min", DoubleValue(0));
+  indexes->SetAttribute("Max", DoubleValue(n-1));
+  Ptr<RandomPositionAllocator> positionAlloc = CreateObject<RandomPositionAllocator>();
+  positionAlloc->SetIndex(indexes);
+
+  string prefix = "/prod";
+  string haprefix = "/ha0";
+  string locprefix = "/loc";
+
+  for (uint32_t i = 0; i < consumers.GetN(); i++) {
+    if (i == ha) ndn::LinkControlHelper::UpLink(consumers.Get(i), producer);
+    else ndn::LinkControlHelper::FailLink(consumers.Get(i), producer);
+  }
+
+  MobilityHelper mobility;
+
+  Ptr<RandomVariableStream> frequency;
+  frequency = CreateObject<ConstantRandomVariable>();
+  frequency->SetAttribute("Constant", DoubleValue(10));
+
+  mobility.SetPositionAllocator(positionAlloc);
+  mobility.SetMobilityModel("ns3::RandomMobilityModel",
+                            "Frequency", PointerValue(frequency),
+                            "PositionAllocator", PointerValue(positionAlloc));
+  mobility.Install(producer);
+
+  ndn::GlobalRoutingHelper ndnGlobalRoutingHelper;
+  ndnGlobalRoutingHelper.InstallAll();
+
+  ndnGlobalRoutingHelper.AddOrigin(haprefix, homeagent);
+  for (uint32_t i = 0; i < consumers.GetN(); i++) {
+    ndnGlobalRoutingHelper.AddOrigin(locprefix + to_string(i), consumers.Get(i));
+    ndnGlobalRoutingHelper.AddOrigin(locprefix + to_string(i) + prefix, producer);
+  }
+
+  ndn::GlobalRoutingHelper::CalculateRoutes();
+
+  Simulator::Stop(Seconds(simulation_time));
+
+  // Runs
+
+  ndn::SweepRunner sweep;
+  sweep.AddDimension("cs", SplitValues(cs));
+  sweep.AddDimension("obj", SplitValues(obj));
+  sweep.AddDimension("req", SplitValues(req));
+  if (processes > 0) {
+    sweep.SetMaxProcesses(processes);
+  }
+
+  uint32_t nFailed = sweep.Run([&] (const ndn::SweepRunner::Point& point, const string& file) {
+      Config::Set("/NodeList/*/$ns3::ndn::ContentStore/MaxSize",
+                  UintegerValue(stoul(point.at("cs"))));
+
+      uint32_t nObjects = stoul(point.at("obj"));
+      double freq = stod(point.at("req")) * nObjects * 60.0 / simulation_time;
+
+      ndn::AppHelper consumerHelper("ns3::ndn::ProbeConsumer");
+      consumerHelper.SetPrefix(prefix);
+      consumerHelper.SetAttribute("Frequency", DoubleValue(freq));
+      consumerHelper.SetAttribute("Objects", UintegerValue(nObjects));
+      consumerHelper.SetAttribute("LocatorCache", BooleanValue(locatorCache));
+      consumerHelper.Install(consumers).Start(Seconds(2));
+
+      ndn::AppHelper agentHelper("ns3::ndn::ProbeAgent");
+      agentHelper.Install(homeagent);
+
+      ndn::AppHelper producerHelper("ns3::ndn::ProbeProducer");
+      producerHelper.SetPrefix(prefix);
+      producerHelper.SetAttribute("PayloadSize", UintegerValue(1024));
+      producerHelper.SetAttribute("Home", VectorValue(Vector(ha,0,0)));
+      producerHelper.SetAttribute("Routers", PointerValue(catalog));
+      producerHelper.Install(producer);
+
+      ndn::AppDelayTracer::InstallAll(file);
+    }, output);
+
+  Simulator::Destroy();
+
+  return nFailed == 0 ? 0 : 1;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  return ns3::main(argc, argv);
+}
@@ -52,6 +52,8 @@ main(int argc, char* argv[])
   uint32_t obj;
   uint32_t cs;
   float req;
+  double statsPeriod = 0;
+  bool locatorCache = false;
 
   // Read optional command-line parameters (e.g., enable visualizer with ./waf --run=<> --visualize
   CommandLine cmd;
@@ -60,6 +62,10 @@ main(int argc, char* argv[])
   cmd.AddValue("obj", "number of objects", obj);
   cmd.AddValue("cs", "cache size", cs);
   cmd.AddValue("req", "requisitions per object", req);
+  cmd.AddValue("statsPeriod", "if positive, print path stretch summaries every statsPeriod seconds",
+               statsPeriod);
+  cmd.AddValue("locatorCache", "consumers send Interests directly to the last known producer "
+               "locator instead of through the home agent", locatorCache);
   cmd.Parse(argc, argv);
 
   // Setting simulation time
@@ -119,6 +125,7 @@ main(int argc, char* argv[])
   consumerHelper.SetAttribute("Frequency", DoubleValue(freq)); // 6 interests a minute
   //consumerHelper.SetAttribute("Frequency", DoubleValue(6.0)); // 6 interests a minute
   consumerHelper.SetAttribute("Objects", UintegerValue(obj)); // 100 objects
+  consumerHelper.SetAttribute("LocatorCache", BooleanValue(locatorCache));
   consumerHelper.Install(consumers).Start(Seconds(2));                     
 
   ndn::AppHelper agentHelper("ns3::ndn::ProbeAgent");
@@ -173,6 +180,10 @@ main(int argc, char* argv[])
 
 //  ndn::AppDelayTracer::Install(consumers, "saida.txt");
   ndn::AppDelayTracer::InstallAll("chain-indirection-n="+to_string(n)+"-cs="+to_string(cs)+"-ha="+to_string(ha)+"-obj="+to_string(obj)+"-req="+to_string(req)+".dat");
+  if (statsPeriod > 0) {
+    ndn::PathStretchTracer::Install(consumers, "chain-indirection-stretch-n=" + to_string(n) + ".txt",
+                                    Seconds(statsPeriod));
+  }
 
   Simulator::Run();
   Simulator::Destroy();
@@ -24,9 +24,7 @@
 
 #include "apps/ndn-app.hpp"
 
-#ifdef NS3_MPI
-#include "ns3/mpi-interface.h"
-#endif
+#include "helper/ndn-partition-helper.hpp"
 
 NS_LOG_COMPONENT_DEFINE("ndn.AppHelper");
 
@@ -84,12 +82,10 @@ AppHelper::Install(NodeContainer c)
 Ptr<Application>
 AppHelper::InstallPriv(Ptr<Node> node)
 {
-#ifdef NS3_MPI
-  if (MpiInterface::IsEnabled() && node->GetSystemId() != MpiInterface::GetSystemId()) {
+  if (!PartitionHelper::IsLocal(node)) {
     // don't create an app if MPI is enabled and node is not in the correct partition
     return 0;
   }
-#endif
 
   Ptr<Application> app = m_factory.Create<Application>();
   node->AddApplication(app);
@@ -108,6 +104,10 @@ ApplicationContainer
 FactoryCallbackApp::Install(Ptr<Node> node, const FactoryCallback& factory)
 {
   ApplicationContainer apps;
+  if (!PartitionHelper::IsLocal(node)) {
+    return apps;
+  }
+
   auto app = CreateObject<FactoryCallbackApp>(factory);
   node->AddApplication(app);
   apps.Add(app);
@@ -82,6 +82,12 @@ FaceContainer::Add(shared_ptr<Face> face)
   m_faces.push_back(face);
 }
 
+void
+FaceContainer::Reserve(size_t n)
+{
+  m_faces.reserve(n);
+}
+
 shared_ptr<Face>
 FaceContainer::Get(size_t i) const
 {
@@ -93,6 +93,12 @@ public:
   void
   AddAll(const FaceContainer& other);
 
+  /**
+   * @brief Reserve space for @p n faces
+   */
+  void
+  Reserve(size_t n);
+
 public: // accessors
   /**
    * @brief Get an iterator which refers to the first pair in the
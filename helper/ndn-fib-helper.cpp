@@ -50,6 +50,19 @@ NS_LOG_COMPONENT_DEFINE("ndn.FibHelper");
 void
 FibHelper::AddNextHop(const ControlParameters& parameters, Ptr<Node> node)
 {
+  Ptr<L3Protocol> l3protocol = node->GetObject<L3Protocol>();
+  if (!l3protocol->isManagementEnabled()) {
+    // bare forwarder: there is no FibManager to process the command
+    nfd::Forwarder& forwarder = *l3protocol->getForwarder();
+    Face* face = forwarder.getFaceTable().get(parameters.getFaceId());
+    NS_ASSERT_MSG(face != nullptr, "Face with ID [" << parameters.getFaceId()
+                                   << "] does not exist on node [" << node->GetId() << "]");
+
+    auto entry = forwarder.getFib().insert(parameters.getName()).first;
+    entry->addNextHop(*face, parameters.hasCost() ? parameters.getCost() : 0);
+    return;
+  }
+
   NS_LOG_DEBUG("Add Next Hop command was initialized");
   Block encodedParameters(parameters.wireEncode());
 
@@ -60,13 +73,29 @@ FibHelper::AddNextHop(const ControlParameters& parameters, Ptr<Node> node)
   shared_ptr<Interest> command(make_shared<Interest>(commandName));
   StackHelper::getKeyChain().sign(*command);
 
-  Ptr<L3Protocol> l3protocol = node->GetObject<L3Protocol>();
   l3protocol->injectInterest(*command);
 }
 
 void
 FibHelper::RemoveNextHop(const ControlParameters& parameters, Ptr<Node> node)
 {
+  Ptr<L3Protocol> l3protocol = node->GetObject<L3Protocol>();
+  if (!l3protocol->isManagementEnabled()) {
+    // bare forwarder: there is no FibManager to process the command
+    nfd::Forwarder& forwarder = *l3protocol->getForwarder();
+    Face* face = forwarder.getFaceTable().get(parameters.getFaceId());
+    auto entry = forwarder.getFib().findExactMatch(parameters.getName());
+    if (face == nullptr || entry == nullptr) {
+      return;
+    }
+
+    entry->removeNextHop(*face);
+    if (!entry->hasNextHops()) {
+      forwarder.getFib().erase(*entry);
+    }
+    return;
+  }
+
   NS_LOG_DEBUG("Remove Next Hop command was initialized");
   Block encodedParameters(parameters.wireEncode());
 
@@ -77,7 +106,6 @@ FibHelper::RemoveNextHop(const ControlParameters& parameters, Ptr<Node> node)
   shared_ptr<Interest> command(make_shared<Interest>(commandName));
   StackHelper::getKeyChain().sign(*command);
 
-  Ptr<L3Protocol> l3protocol = node->GetObject<L3Protocol>();
   l3protocol->injectInterest(*command);
 }
 
@@ -27,6 +27,7 @@
 
 #include "model/ndn-l3-protocol.hpp"
 #include "helper/ndn-fib-helper.hpp"
+#include "helper/ndn-partition-helper.hpp"
 #include "model/ndn-net-device-transport.hpp"
 #include "model/ndn-global-router.hpp"
 
@@ -46,6 +47,7 @@
 #include "ns3/node-list.h"
 #include "ns3/channel-list.h"
 #include "ns3/object-factory.h"
+#include "ns3/simulator.h"
 
 #include <boost/lexical_cast.hpp>
 #include <boost/foreach.hpp>
@@ -227,14 +229,21 @@ GlobalRoutingHelper::AddOriginsForAll()
 uint32_t
 GlobalRoutingHelper::CalculateRoutes()
 {
-  
+  std::map<Name, uint32_t> changes;
+  changes[Name("/prod")] = 0;
+
+  CalculateRoutes(changes);
+  return changes[Name("/prod")];
+}
+
+void
+GlobalRoutingHelper::CalculateRoutes(std::map<Name, uint32_t>& changes)
+{
   /**
    * Implementation of route calculation is heavily based on Boost Graph Library
    * See http://www.boost.org/doc/libs/1_49_0/libs/graph/doc/table_of_contents.html for more details
    */
 
-  uint32_t changes = 0;
-
   BOOST_CONCEPT_ASSERT((boost::VertexListGraphConcept<boost::NdnGlobalRouterGraph>));
   BOOST_CONCEPT_ASSERT((boost::IncidenceGraphConcept<boost::NdnGlobalRouterGraph>));
 
@@ -251,6 +260,9 @@ GlobalRoutingHelper::CalculateRoutes()
       NS_LOG_DEBUG("Node " << (*node)->GetId() << " does not export GlobalRouter interface");
       continue;
     }
+    if (!PartitionHelper::IsLocal(*node)) {
+      continue; // FIB is populated by the process that simulates the node
+    }
 
     boost::DistancesMap distances;
 
@@ -284,12 +296,13 @@ GlobalRoutingHelper::CalculateRoutes()
             //             << std::get<2>(dist.second));
 
             //shared_ptr<fib::Entry> fibEntry = forwarder->getFib().findLongestPrefixMatch(*prefix);
-            if (prefix->toUri() == "/prod") {
+            auto counter = changes.find(*prefix);
+            if (counter != changes.end()) {
               for (const auto& nexthops : forwarder->getFib().findLongestPrefixMatch(*prefix).getNextHops()) {
                 shared_ptr<Face> face = std::get<0>(dist.second);
                 if (nexthops.getFace().getId() != face->getId()) {
                   NS_LOG_DEBUG("Change for " << *prefix << ": " << nexthops.getFace().getId() << " == " << face->getId());
-                  changes++;
+                  counter->second++;
                 }
               }
             }
@@ -304,8 +317,77 @@ GlobalRoutingHelper::CalculateRoutes()
       }
     }
   }
-  NS_LOG_DEBUG("Total changes: " << changes);
-  return changes;
+  for (const auto& counter : changes) {
+    NS_LOG_DEBUG("Total changes for " << counter.first << ": " << counter.second);
+  }
+}
+
+/// @cond include_hidden
+namespace {
+
+struct RouteCalculationRequest {
+  Name prefix;
+  Callback<void, uint32_t> onCalculated;
+};
+
+Time g_routeCalculationHoldDown = Seconds(0);
+Time g_convergenceDelay = Seconds(0);
+
+std::vector<RouteCalculationRequest> g_routeCalculationRequests;
+EventId g_routeCalculationEvent;
+
+} // namespace
+/// @endcond
+
+void
+GlobalRoutingHelper::SetRouteCalculationHoldDown(Time holdDown)
+{
+  g_routeCalculationHoldDown = holdDown;
+}
+
+void
+GlobalRoutingHelper::SetConvergenceDelay(Time delay)
+{
+  g_convergenceDelay = delay;
+}
+
+void
+GlobalRoutingHelper::RequestRouteCalculation(const Name& prefix,
+                                             Callback<void, uint32_t> onCalculated)
+{
+  if (!g_routeCalculationEvent.IsRunning()) {
+    // requests left from a simulation that has been destroyed before they were served
+    g_routeCalculationRequests.clear();
+
+    g_routeCalculationEvent =
+      Simulator::Schedule(g_routeCalculationHoldDown + g_convergenceDelay,
+                          &GlobalRoutingHelper::ProcessRouteCalculationRequests);
+  }
+
+  // requests issued while converging are served by the pending run as well, since it reads the
+  // topology at the time routes are installed
+  g_routeCalculationRequests.push_back({prefix, onCalculated});
+}
+
+void
+GlobalRoutingHelper::ProcessRouteCalculationRequests()
+{
+  std::vector<RouteCalculationRequest> requests;
+  requests.swap(g_routeCalculationRequests);
+
+  std::map<Name, uint32_t> changes;
+  for (const auto& request : requests) {
+    changes[request.prefix] = 0;
+  }
+
+  NS_LOG_DEBUG("Calculating routes for " << requests.size() << " coalesced requests");
+  CalculateRoutes(changes);
+
+  for (const auto& request : requests) {
+    if (!request.onCalculated.IsNull()) {
+      request.onCalculated(changes[request.prefix]);
+    }
+  }
 }
 
 void
@@ -332,6 +414,9 @@ GlobalRoutingHelper::CalculateAllPossibleRoutes()
       NS_LOG_DEBUG("Node " << (*node)->GetId() << " does not export GlobalRouter interface");
       continue;
     }
+    if (!PartitionHelper::IsLocal(*node)) {
+      continue; // FIB is populated by the process that simulates the node
+    }
 
     Ptr<L3Protocol> L3protocol = (*node)->GetObject<L3Protocol>();
     shared_ptr<nfd::Forwarder> forwarder = L3protocol->getForwarder();
@@ -23,6 +23,10 @@
 #include "ns3/ndnSIM/model/ndn-common.hpp"
 
 #include "ns3/ptr.h"
+#include "ns3/nstime.h"
+#include "ns3/callback.h"
+
+#include <map>
 
 namespace ns3 {
 
@@ -108,6 +112,34 @@ public:
   static uint32_t
   CalculateRoutes();
 
+  /**
+   * @brief Request (coalesced) recalculation of routes after a topology or origin change
+   *
+   * All requests issued within the hold-down interval are served by a single CalculateRoutes
+   * run, which happens at the end of the interval plus the convergence delay.  @p onCalculated
+   * is then invoked with the number of FIB changes for @p prefix.
+   *
+   * @param prefix       Prefix for which FIB changes are counted
+   * @param onCalculated Callback invoked once routes are recalculated
+   */
+  static void
+  RequestRouteCalculation(const Name& prefix, Callback<void, uint32_t> onCalculated);
+
+  /**
+   * @brief Set interval during which route calculation requests are collected (default 0)
+   *
+   * With zero hold-down, only requests issued at the same simulation time are coalesced.
+   */
+  static void
+  SetRouteCalculationHoldDown(Time holdDown);
+
+  /**
+   * @brief Set delay between the end of the hold-down interval and installation of the new
+   *        routes, modeling convergence of a routing protocol (default 0)
+   */
+  static void
+  SetConvergenceDelay(Time delay);
+
   /**
    * @brief Calculate all possible next-hop independent alternative routes
    *
@@ -128,6 +160,15 @@ public:
 private:
   void
   Install(Ptr<Channel> channel);
+
+  /**
+   * @brief Calculate routes and count FIB changes for each prefix in @p changes
+   */
+  static void
+  CalculateRoutes(std::map<Name, uint32_t>& changes);
+
+  static void
+  ProcessRouteCalculationRequests();
 };
 
 } // namespace ndn
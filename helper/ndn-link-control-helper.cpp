@@ -23,78 +23,195 @@
 #include "ns3/names.h"
 #include "ns3/point-to-point-net-device.h"
 #include "ns3/point-to-point-channel.h"
-#include "ns3/channel.h"
 #include "ns3/log.h"
 #include "ns3/error-model.h"
 #include "ns3/string.h"
 #include "ns3/boolean.h"
 #include "ns3/double.h"
-#include "ns3/pointer.h"
+#include "ns3/simulator.h"
 
 #include "model/ndn-l3-protocol.hpp"
-#include "model/ndn-net-device-transport.hpp"
 #include "NFD/daemon/face/face.hpp"
+#include "NFD/daemon/fw/forwarder.hpp"
 
-#include "fw/forwarder.hpp"
+#include <unordered_map>
+#include <vector>
 
 NS_LOG_COMPONENT_DEFINE("ndn.LinkControlHelper");
 
 namespace ns3 {
 namespace ndn {
 
+namespace {
+
+/**
+ * @brief Devices of a point-to-point link with NDN face, as seen from one of its nodes
+ */
+struct LinkDevices
+{
+  Ptr<PointToPointNetDevice> local;
+  Ptr<PointToPointNetDevice> remote;
+};
+
+/**
+ * @brief Links of an indexed node, by ID of the node on the other side
+ *
+ * Parallel links to the same peer are kept in the order of node's devices
+ */
+typedef std::unordered_map<uint32_t, std::vector<LinkDevices>> NodeLinks;
+
+/**
+ * @brief Index entry of a node, re-indexed on next use after a face is added or removed
+ */
+struct IndexedNode
+{
+  NodeLinks links;
+  bool isStale = false;
+  ::ndn::util::signal::ScopedConnection afterAddFace;
+  ::ndn::util::signal::ScopedConnection beforeRemoveFace;
+};
+
+std::unordered_map<uint32_t, IndexedNode> g_linkTable;
+Ptr<ErrorModel> g_failedErrorModel;
+Ptr<ErrorModel> g_upErrorModel;
+bool g_isClearScheduled = false;
+
 void
-LinkControlHelper::setErrorRate(Ptr<Node> node1, Ptr<Node> node2, double errorRate)
+clearLinkTable()
 {
-  NS_LOG_FUNCTION(node1 << node2 << errorRate);
+  g_linkTable.clear();
+  g_failedErrorModel = nullptr;
+  g_upErrorModel = nullptr;
+  g_isClearScheduled = false;
+}
 
-  NS_ASSERT(node1 != nullptr && node2 != nullptr);
-  NS_ASSERT(errorRate <= 1.0);
+void
+markStale(uint32_t nodeId)
+{
+  auto indexed = g_linkTable.find(nodeId);
+  if (indexed != g_linkTable.end()) {
+    indexed->second.isStale = true;
+  }
+}
 
-  Ptr<ndn::L3Protocol> ndn1 = node1->GetObject<ndn::L3Protocol>();
-  Ptr<ndn::L3Protocol> ndn2 = node2->GetObject<ndn::L3Protocol>();
+NodeLinks&
+indexNode(Ptr<Node> node)
+{
+  NS_LOG_FUNCTION(node);
 
-  NS_ASSERT(ndn1 != nullptr && ndn2 != nullptr);
+  // node IDs are reused in the next simulation
+  if (!g_isClearScheduled) {
+    Simulator::ScheduleDestroy(&clearLinkTable);
+    g_isClearScheduled = true;
+  }
 
-  // iterate over all faces to find the right one
-  for (const auto& face : ndn1->getForwarder()->getFaceTable()) {
-    auto transport = dynamic_cast<NetDeviceTransport*>(face.getTransport());
-    if (transport == nullptr)
-      continue;
+  Ptr<L3Protocol> ndn = node->GetObject<L3Protocol>();
+  NS_ASSERT(ndn != nullptr);
+
+  uint32_t nodeId = node->GetId();
+  IndexedNode& indexed = g_linkTable[nodeId];
+  if (!indexed.afterAddFace.isConnected()) {
+    // links created or removed later (e.g., by StackHelper::Update) invalidate the entry
+    nfd::FaceTable& faceTable = ndn->getForwarder()->getFaceTable();
+    indexed.afterAddFace = faceTable.afterAdd.connect([nodeId] (Face&) {
+        markStale(nodeId);
+      });
+    indexed.beforeRemoveFace = faceTable.beforeRemove.connect([nodeId] (Face&) {
+        markStale(nodeId);
+      });
+  }
+  indexed.isStale = false;
 
-    Ptr<PointToPointNetDevice> nd1 = transport->GetNetDevice()->GetObject<PointToPointNetDevice>();
-    if (nd1 == nullptr)
+  NodeLinks& links = indexed.links;
+  links.clear();
+
+  for (uint32_t deviceId = 0; deviceId < node->GetNDevices(); ++deviceId) {
+    Ptr<PointToPointNetDevice> device =
+      DynamicCast<PointToPointNetDevice>(node->GetDevice(deviceId));
+    if (device == nullptr)
       continue;
 
-    Ptr<Channel> channel = nd1->GetChannel();
-    if (channel == nullptr)
+    Ptr<PointToPointChannel> channel = DynamicCast<PointToPointChannel>(device->GetChannel());
+    if (channel == nullptr || ndn->getFaceByNetDevice(device) == nullptr)
       continue;
 
-    Ptr<PointToPointChannel> ppChannel = DynamicCast<PointToPointChannel>(channel);
+    Ptr<PointToPointNetDevice> remote = channel->GetPointToPointDevice(0);
+    if (remote == device)
+      remote = channel->GetPointToPointDevice(1);
 
-    Ptr<NetDevice> nd2 = ppChannel->GetDevice(0);
-    if (nd2->GetNode() == node1)
-      nd2 = ppChannel->GetDevice(1);
+    links[remote->GetNode()->GetId()].push_back(LinkDevices{device, remote});
+  }
 
-    if (nd2->GetNode() == node2) {
-      ObjectFactory errorFactory("ns3::RateErrorModel");
-      errorFactory.Set("ErrorUnit", StringValue("ERROR_UNIT_PACKET"));
-      errorFactory.Set("ErrorRate", DoubleValue(errorRate));
-      if (errorRate <= 0) {
-        errorFactory.Set("IsEnabled", BooleanValue(false));
-      }
+  return links;
+}
 
-      nd1->SetAttribute("ReceiveErrorModel", PointerValue(errorFactory.Create<ErrorModel>()));
-      nd2->SetAttribute("ReceiveErrorModel", PointerValue(errorFactory.Create<ErrorModel>()));
-      return;
-    }
+const NodeLinks&
+getNodeLinks(Ptr<Node> node)
+{
+  auto indexed = g_linkTable.find(node->GetId());
+  if (indexed != g_linkTable.end() && !indexed->second.isStale)
+    return indexed->second.links;
+
+  return indexNode(node);
+}
+
+/**
+ * @brief Find the first (in node1's device order) of the links between two nodes
+ */
+const LinkDevices&
+findLink(Ptr<Node> node1, Ptr<Node> node2)
+{
+  auto indexed = g_linkTable.find(node1->GetId());
+  if (indexed != g_linkTable.end() && !indexed->second.isStale) {
+    auto link = indexed->second.links.find(node2->GetId());
+    if (link != indexed->second.links.end())
+      return link->second.front();
+  }
+
+  // node is not indexed yet, its faces changed, or the link has no NDN face yet
+  NodeLinks& links = indexNode(node1);
+  auto link = links.find(node2->GetId());
+  if (link == links.end()) {
+    NS_FATAL_ERROR("There is no link to fail between the requested nodes");
+  }
+  return link->second.front();
+}
+
+Ptr<ErrorModel>
+getErrorModel(bool isUp)
+{
+  Ptr<ErrorModel>& model = isUp ? g_upErrorModel : g_failedErrorModel;
+  if (model == nullptr) {
+    ObjectFactory errorFactory("ns3::RateErrorModel");
+    errorFactory.Set("ErrorUnit", StringValue("ERROR_UNIT_PACKET"));
+    errorFactory.Set("ErrorRate", DoubleValue(isUp ? 0.0 : 1.0));
+    errorFactory.Set("IsEnabled", BooleanValue(!isUp));
+    model = errorFactory.Create<ErrorModel>();
   }
-  NS_FATAL_ERROR("There is no link to fail between the requested nodes");
+  return model;
+}
+
+} // namespace
+
+void
+LinkControlHelper::setLinkState(Ptr<Node> node1, Ptr<Node> node2, bool isUp)
+{
+  NS_LOG_FUNCTION(node1 << node2 << isUp);
+
+  NS_ASSERT(node1 != nullptr && node2 != nullptr);
+  NS_ASSERT(node2->GetObject<ndn::L3Protocol>() != nullptr);
+
+  const LinkDevices& link = findLink(node1, node2);
+
+  Ptr<ErrorModel> errorModel = getErrorModel(isUp);
+  link.local->SetReceiveErrorModel(errorModel);
+  link.remote->SetReceiveErrorModel(errorModel);
 }
 
 void
 LinkControlHelper::FailLink(Ptr<Node> node1, Ptr<Node> node2)
 {
-  setErrorRate(node1, node2, 1.0);
+  setLinkState(node1, node2, false);
 }
 
 void
@@ -106,7 +223,7 @@ LinkControlHelper::FailLinkByName(const std::string& node1, const std::string& n
 void
 LinkControlHelper::UpLink(Ptr<Node> node1, Ptr<Node> node2)
 {
-  setErrorRate(node1, node2, -0.1); // this will ensure error model is disabled
+  setLinkState(node1, node2, true);
 }
 
 void
@@ -115,5 +232,53 @@ LinkControlHelper::UpLinkByName(const std::string& node1, const std::string& nod
   UpLink(Names::Find<Node>(node1), Names::Find<Node>(node2));
 }
 
+void
+LinkControlHelper::FailLinks(const LinkList& links)
+{
+  for (const auto& link : links) {
+    setLinkState(link.first, link.second, false);
+  }
+}
+
+void
+LinkControlHelper::UpLinks(const LinkList& links)
+{
+  for (const auto& link : links) {
+    setLinkState(link.first, link.second, true);
+  }
+}
+
+void
+LinkControlHelper::FailNodeLinks(const NodeContainer& nodes)
+{
+  NS_LOG_FUNCTION(nodes.GetN());
+
+  Ptr<ErrorModel> errorModel = getErrorModel(false);
+  for (NodeContainer::Iterator node = nodes.Begin(); node != nodes.End(); ++node) {
+    for (const auto& peerLinks : getNodeLinks(*node)) {
+      for (const LinkDevices& link : peerLinks.second) {
+        link.local->SetReceiveErrorModel(errorModel);
+        link.remote->SetReceiveErrorModel(errorModel);
+      }
+    }
+  }
+}
+
+void
+LinkControlHelper::UpNodeLinks(const NodeContainer& nodes)
+{
+  NS_LOG_FUNCTION(nodes.GetN());
+
+  Ptr<ErrorModel> errorModel = getErrorModel(true);
+  for (NodeContainer::Iterator node = nodes.Begin(); node != nodes.End(); ++node) {
+    for (const auto& peerLinks : getNodeLinks(*node)) {
+      for (const LinkDevices& link : peerLinks.second) {
+        link.local->SetReceiveErrorModel(errorModel);
+        link.remote->SetReceiveErrorModel(errorModel);
+      }
+    }
+  }
+}
+
 } // namespace ndn
 } // namespace ns3
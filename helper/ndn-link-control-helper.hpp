@@ -24,6 +24,10 @@
 
 #include "ns3/ptr.h"
 #include "ns3/node.h"
+#include "ns3/node-container.h"
+
+#include <utility>
+#include <vector>
 
 namespace ns3 {
 namespace ndn {
@@ -32,9 +36,24 @@ namespace ndn {
  * @ingroup ndn-helpers
  * @brief Helper class to control the up or down statuss of an NDN link connecting two specific
  *        nodes
+ *
+ * Point-to-point links of a node are indexed the first time the node is passed to the helper,
+ * re-indexed on next use after a face is added to or removed from the node, and the index is
+ * cleared when the simulator is destroyed.  Failing or re-enabling an indexed link only swaps
+ * the receive error models of its two devices (failed and up error models are shared by all
+ * links).
+ *
+ * If two nodes are connected by several parallel links, FailLink, UpLink and their batch
+ * variants toggle only the first of them (in the order of node1's devices), while
+ * FailNodeLinks and UpNodeLinks toggle all links of the nodes.
  */
 class LinkControlHelper {
 public:
+  /**
+   * @brief List of links, each specified by the pair of nodes it connects
+   */
+  typedef std::vector<std::pair<Ptr<Node>, Ptr<Node>>> LinkList;
+
   /**
    * @brief Fail NDN link between two nodes
    *
@@ -95,9 +114,44 @@ public:
   static void
   UpLinkByName(const std::string& node1, const std::string& node2);
 
+  /**
+   * @brief Fail several NDN links at once
+   *
+   * @param links pairs of nodes connected by the links to fail
+   */
+  static void
+  FailLinks(const LinkList& links);
+
+  /**
+   * @brief Re-enable several NDN links at once
+   *
+   * @param links pairs of nodes connected by the links to re-enable
+   */
+  static void
+  UpLinks(const LinkList& links);
+
+  /**
+   * @brief Fail all NDN links of the nodes (e.g., outage of an area)
+   *
+   * Links between the nodes and the rest of the topology, as well as links between the nodes
+   * themselves, are failed
+   *
+   * @param nodes nodes to isolate
+   */
+  static void
+  FailNodeLinks(const NodeContainer& nodes);
+
+  /**
+   * @brief Re-enable all NDN links of the nodes
+   *
+   * @param nodes nodes to reconnect
+   */
+  static void
+  UpNodeLinks(const NodeContainer& nodes);
+
 private:
   static void
-  setErrorRate(Ptr<Node> node1, Ptr<Node> node2, double errorRate);
+  setLinkState(Ptr<Node> node1, Ptr<Node> node2, bool isUp);
 }; // LinkControlHelper
 
 } // ndn
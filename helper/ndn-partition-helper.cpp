@@ -0,0 +1,297 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-partition-helper.hpp"
+
+#include "ns3/log.h"
+#include "ns3/assert.h"
+
+#ifdef NS3_MPI
+#include "ns3/mpi-interface.h"
+#endif
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <queue>
+
+NS_LOG_COMPONENT_DEFINE("ndn.PartitionHelper");
+
+namespace ns3 {
+namespace ndn {
+
+uint32_t
+PartitionHelper::AddVertex(double weight)
+{
+  m_vertices.push_back(weight);
+  return m_vertices.size() - 1;
+}
+
+void
+PartitionHelper::AddEdge(uint32_t from, uint32_t to, Time delay, double traffic)
+{
+  NS_ASSERT(from < m_vertices.size() && to < m_vertices.size());
+  m_edges.push_back({from, to, delay, traffic});
+}
+
+uint32_t
+PartitionHelper::GetNVertices() const
+{
+  return m_vertices.size();
+}
+
+void
+PartitionHelper::SetImbalance(double imbalance)
+{
+  m_imbalance = imbalance;
+}
+
+double
+PartitionHelper::GetCost(size_t edge, Time maxDelay) const
+{
+  // the shorter the link compared to the longest one, the more lookahead is lost when it is cut
+  double delay = std::max(m_edges[edge].delay.GetSeconds(), 1e-9);
+  return m_edges[edge].traffic * std::max(maxDelay.GetSeconds(), 1e-9) / delay;
+}
+
+std::vector<uint32_t>
+PartitionHelper::Partition(uint32_t nPartitions) const
+{
+  const uint32_t UNASSIGNED = std::numeric_limits<uint32_t>::max();
+  const uint32_t MAX_REFINEMENT_PASSES = 16;
+
+  uint32_t n = m_vertices.size();
+  if (nPartitions <= 1 || n == 0) {
+    return std::vector<uint32_t>(n, 0);
+  }
+  if (nPartitions > n) {
+    NS_FATAL_ERROR("Cannot split " << n << " nodes into " << nPartitions << " partitions");
+  }
+
+  // adjacency lists in compressed form, with the cost of cutting each edge
+  Time maxDelay;
+  for (const auto& edge : m_edges) {
+    maxDelay = std::max(maxDelay, edge.delay);
+  }
+
+  std::vector<uint32_t> offsets(n + 1, 0);
+  for (const auto& edge : m_edges) {
+    if (edge.from != edge.to) {
+      offsets[edge.from + 1]++;
+      offsets[edge.to + 1]++;
+    }
+  }
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+  std::vector<std::pair<uint32_t, double>> adjacency(offsets.back());
+  std::vector<uint32_t> cursor(offsets.begin(), offsets.end() - 1);
+  for (size_t i = 0; i < m_edges.size(); ++i) {
+    const Edge& edge = m_edges[i];
+    if (edge.from != edge.to) {
+      double cost = GetCost(i, maxDelay);
+      adjacency[cursor[edge.from]++] = {edge.to, cost};
+      adjacency[cursor[edge.to]++] = {edge.from, cost};
+    }
+  }
+
+  double totalWeight = std::accumulate(m_vertices.begin(), m_vertices.end(), 0.0);
+  double target = totalWeight / nPartitions;
+  double maxWeight = std::max(target * (1 + m_imbalance),
+                              target + *std::max_element(m_vertices.begin(), m_vertices.end()));
+
+  // initial partition: grow each part from a seed, adding the frontier vertex most strongly
+  // connected to the part, until the part reaches its share of the total weight
+  std::vector<uint32_t> partitions(n, UNASSIGNED);
+  std::vector<double> partWeight(nPartitions, 0);
+  std::vector<uint32_t> partSize(nPartitions, 0);
+  std::vector<double> connection(n, 0);
+  uint32_t nAssigned = 0;
+  double assignedWeight = 0;
+  uint32_t nextSeed = 0;
+
+  for (uint32_t part = 0; part < nPartitions; ++part) {
+    bool isLast = (part + 1 == nPartitions);
+    // share of the weight not yet taken by the previous parts
+    double partTarget = (totalWeight - assignedWeight) / (nPartitions - part);
+    std::priority_queue<std::pair<double, uint32_t>> frontier;
+    std::vector<uint32_t> touched;
+
+    while (isLast || partWeight[part] < partTarget) {
+      // leave at least one vertex for each of the remaining parts
+      if (!isLast && partSize[part] > 0 && n - nAssigned <= nPartitions - part - 1) {
+        break;
+      }
+
+      uint32_t vertex = UNASSIGNED;
+      while (!frontier.empty()) {
+        auto top = frontier.top();
+        frontier.pop();
+        if (partitions[top.second] == UNASSIGNED && top.first == connection[top.second]) {
+          vertex = top.second;
+          break;
+        }
+      }
+
+      if (vertex == UNASSIGNED) {
+        // start from a new seed (first part or disconnected topology)
+        while (nextSeed < n && partitions[nextSeed] != UNASSIGNED) {
+          ++nextSeed;
+        }
+        if (nextSeed == n) {
+          break;
+        }
+        vertex = nextSeed;
+      }
+
+      partitions[vertex] = part;
+      partWeight[part] += m_vertices[vertex];
+      partSize[part]++;
+      nAssigned++;
+
+      for (uint32_t i = offsets[vertex]; i < offsets[vertex + 1]; ++i) {
+        uint32_t neighbor = adjacency[i].first;
+        if (partitions[neighbor] == UNASSIGNED) {
+          connection[neighbor] += adjacency[i].second;
+          touched.push_back(neighbor);
+          frontier.push({connection[neighbor], neighbor});
+        }
+      }
+    }
+
+    for (uint32_t vertex : touched) {
+      connection[vertex] = 0;
+    }
+    assignedWeight += partWeight[part];
+  }
+
+  // refinement: move boundary vertices to the neighboring part they are most strongly connected
+  // to, as long as this reduces the cut and keeps the balance
+  std::vector<double> partConnection(nPartitions, 0);
+  std::vector<uint32_t> neighborParts;
+  for (uint32_t pass = 0; pass < MAX_REFINEMENT_PASSES; ++pass) {
+    uint32_t nMoves = 0;
+
+    for (uint32_t vertex = 0; vertex < n; ++vertex) {
+      uint32_t own = partitions[vertex];
+
+      neighborParts.clear();
+      for (uint32_t i = offsets[vertex]; i < offsets[vertex + 1]; ++i) {
+        uint32_t part = partitions[adjacency[i].first];
+        if (partConnection[part] == 0) {
+          neighborParts.push_back(part);
+        }
+        partConnection[part] += adjacency[i].second;
+      }
+
+      uint32_t best = own;
+      double bestGain = 0;
+      for (uint32_t part : neighborParts) {
+        double gain = partConnection[part] - partConnection[own];
+        if (part != own && gain > bestGain && partSize[own] > 1
+            && partWeight[part] + m_vertices[vertex] <= maxWeight) {
+          best = part;
+          bestGain = gain;
+        }
+      }
+
+      for (uint32_t part : neighborParts) {
+        partConnection[part] = 0;
+      }
+      partConnection[own] = 0;
+
+      if (best != own) {
+        partitions[vertex] = best;
+        partWeight[own] -= m_vertices[vertex];
+        partWeight[best] += m_vertices[vertex];
+        partSize[own]--;
+        partSize[best]++;
+        nMoves++;
+      }
+    }
+
+    NS_LOG_DEBUG("Refinement pass " << pass << ": " << nMoves << " moves");
+    if (nMoves == 0) {
+      break;
+    }
+  }
+
+  NS_LOG_INFO(n << " nodes split into " << nPartitions << " partitions, cut traffic "
+              << GetCutTraffic(partitions) << ", lookahead " << GetLookahead(partitions));
+  return partitions;
+}
+
+double
+PartitionHelper::GetCutTraffic(const std::vector<uint32_t>& partitions) const
+{
+  double traffic = 0;
+  for (const auto& edge : m_edges) {
+    if (partitions[edge.from] != partitions[edge.to]) {
+      traffic += edge.traffic;
+    }
+  }
+  return traffic;
+}
+
+Time
+PartitionHelper::GetLookahead(const std::vector<uint32_t>& partitions) const
+{
+  Time lookahead = Time::Max();
+  for (const auto& edge : m_edges) {
+    if (partitions[edge.from] != partitions[edge.to]) {
+      lookahead = std::min(lookahead, edge.delay);
+    }
+  }
+  return lookahead;
+}
+
+uint32_t
+PartitionHelper::GetNPartitions()
+{
+#ifdef NS3_MPI
+  if (MpiInterface::IsEnabled()) {
+    return MpiInterface::GetSize();
+  }
+#endif
+  return 1;
+}
+
+bool
+PartitionHelper::IsLocal(Ptr<Node> node)
+{
+#ifdef NS3_MPI
+  if (MpiInterface::IsEnabled()) {
+    return node->GetSystemId() == MpiInterface::GetSystemId();
+  }
+#endif
+  return true;
+}
+
+std::string
+PartitionHelper::GetLocalFileName(const std::string& file)
+{
+#ifdef NS3_MPI
+  if (file != "-" && MpiInterface::IsEnabled() && MpiInterface::GetSize() > 1) {
+    return file + "." + std::to_string(MpiInterface::GetSystemId());
+  }
+#endif
+  return file;
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,143 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_PARTITION_HELPER_H
+#define NDN_PARTITION_HELPER_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ns3/ptr.h"
+#include "ns3/node.h"
+#include "ns3/nstime.h"
+
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-helpers
+ * @brief Helper to partition a topology for distributed (MPI) simulation
+ *
+ * The topology is described as a graph of vertices (nodes, weighted by the expected load) and
+ * edges (links, weighted by the expected traffic and annotated with the link delay).  Partition()
+ * assigns vertices to partitions (systemIds) of balanced load while minimizing the weight of the
+ * cut edges.  Cutting a link with a short delay is penalized in proportion to the loss of
+ * lookahead, as the smallest delay of the cut links limits the synchronization window of the
+ * distributed simulator.
+ *
+ * As ns-3 fixes systemId of a node at its creation, the topology readers use this helper before
+ * creating nodes (see AnnotatedTopologyReader::SetPartitions).
+ */
+class PartitionHelper {
+public:
+  /**
+   * @brief Add vertex with @p weight (e.g., expected number of processed packets)
+   * @return index of the vertex
+   */
+  uint32_t
+  AddVertex(double weight = 1.0);
+
+  /**
+   * @brief Add edge between vertices @p from and @p to
+   * @param delay   propagation delay of the link
+   * @param traffic expected traffic over the link (relative)
+   */
+  void
+  AddEdge(uint32_t from, uint32_t to, Time delay, double traffic = 1.0);
+
+  uint32_t
+  GetNVertices() const;
+
+  /**
+   * @brief Set allowed imbalance of partition weights (default 0.05, i.e., up to 5% above average)
+   */
+  void
+  SetImbalance(double imbalance);
+
+  /**
+   * @brief Partition vertices into @p nPartitions parts
+   *
+   * Greedy graph growing produces the initial partition, which is then refined by
+   * Kernighan-Lin style moves of boundary vertices with positive gain that keep the balance.
+   *
+   * @return partition of each vertex
+   */
+  std::vector<uint32_t>
+  Partition(uint32_t nPartitions) const;
+
+  /**
+   * @brief Get total traffic of edges between different partitions
+   */
+  double
+  GetCutTraffic(const std::vector<uint32_t>& partitions) const;
+
+  /**
+   * @brief Get the smallest delay of edges between different partitions (lookahead)
+   * @return Time::Max() if no edges are cut
+   */
+  Time
+  GetLookahead(const std::vector<uint32_t>& partitions) const;
+
+public:
+  /**
+   * @brief Number of partitions in the running simulation (size of MPI world or 1)
+   */
+  static uint32_t
+  GetNPartitions();
+
+  /**
+   * @brief Check whether @p node is simulated by this process
+   *
+   * Always true unless MPI is enabled
+   */
+  static bool
+  IsLocal(Ptr<Node> node);
+
+  /**
+   * @brief Make name of per-process output file (@p file followed by ".<systemId>" if the
+   *        simulation is distributed; "-" is kept intact)
+   */
+  static std::string
+  GetLocalFileName(const std::string& file);
+
+private:
+  /**
+   * @brief Cost of cutting the edge
+   */
+  double
+  GetCost(size_t edge, Time maxDelay) const;
+
+private:
+  struct Edge {
+    uint32_t from;
+    uint32_t to;
+    Time delay;
+    double traffic;
+  };
+
+  std::vector<double> m_vertices;
+  std::vector<Edge> m_edges;
+  double m_imbalance = 0.05;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_PARTITION_HELPER_H
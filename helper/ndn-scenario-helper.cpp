@@ -88,6 +88,12 @@ ScenarioHelper::disableForwarderStatusManager()
   ndnHelper.disableForwarderStatusManager();
 }
 
+void
+ScenarioHelper::disableManagement()
+{
+  ndnHelper.disableManagement();
+}
+
 void
 ScenarioHelper::addRoutes(std::initializer_list<ScenarioHelper::RouteInfo> routes)
 {
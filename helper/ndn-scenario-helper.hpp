@@ -190,6 +190,12 @@ public: // topology accessors
   void
   disableForwarderStatusManager();
 
+  /**
+   * \brief Disable NFD management altogether ("bare forwarder")
+   */
+  void
+  disableManagement();
+
   /**
    * \brief Get NDN stack helper, e.g., to adjust its parameters
    */
@@ -29,11 +29,13 @@
 #include "model/ndn-net-device-transport.hpp"
 #include "utils/ndn-time.hpp"
 #include "utils/dummy-keychain.hpp"
+#include "utils/ndn-profiler.hpp"
 #include "model/cs/ndn-content-store.hpp"
 
 #include <limits>
 #include <map>
-#include <boost/lexical_cast.hpp>
+#include <thread>
+#include <boost/property_tree/ptree.hpp>
 
 #include "ns3/ndnSIM/NFD/daemon/face/generic-link-service.hpp"
 #include "ns3/ndnSIM/NFD/daemon/table/cs-policy-priority-fifo.hpp"
@@ -49,10 +51,13 @@ StackHelper::StackHelper()
   // , m_isFaceManagerDisabled(false)
   , m_isForwarderStatusManagerDisabled(false)
   , m_isStrategyChoiceManagerDisabled(false)
+  , m_isManagementDisabled(false)
   , m_needSetDefaultRoutes(false)
   , m_maxCsSize(100)
+  , m_nInstallThreads(std::max(1u, std::thread::hardware_concurrency()))
 {
   setCustomNdnCxxClocks();
+  Profiler::InstallFromEnvironment();
 
   m_csPolicies.insert({"nfd::cs::lru", [] { return make_unique<nfd::cs::LruPolicy>(); }});
   m_csPolicies.insert({"nfd::cs::priority_fifo", [] () { return make_unique<nfd::cs::PriorityFifoPolicy>(); }});
@@ -117,6 +122,7 @@ StackHelper::SetOldContentStore(const std::string& contentStore, const std::stri
                                 const std::string& value4)
 {
   m_maxCsSize = 0;
+  m_config = nullptr;
 
   m_contentStoreFactory.SetTypeId(contentStore);
   if (attr1 != "")
@@ -133,6 +139,7 @@ void
 StackHelper::setCsSize(size_t maxSize)
 {
   m_maxCsSize = maxSize;
+  m_config = nullptr;
 }
 
 void
@@ -151,13 +158,30 @@ StackHelper::setPolicy(const std::string& policy)
   }
 }
 
+void
+StackHelper::setInstallThreads(uint32_t nThreads)
+{
+  m_nInstallThreads = std::max(1u, nThreads);
+}
+
 Ptr<FaceContainer>
 StackHelper::Install(const NodeContainer& c) const
 {
   Ptr<FaceContainer> faces = Create<FaceContainer>();
+
+  size_t nDevices = 0;
+  for (NodeContainer::Iterator i = c.Begin(); i != c.End(); ++i) {
+    nDevices += (*i)->GetNDevices();
+  }
+  faces->Reserve(nDevices);
+
+  precomputeFaceUris(c);
+
   for (NodeContainer::Iterator i = c.Begin(); i != c.End(); ++i) {
-    faces->AddAll(Install(*i));
+    doInstall(*i, *faces);
   }
+
+  m_faceUris.clear();
   return faces;
 }
 
@@ -167,36 +191,62 @@ StackHelper::InstallAll() const
   return Install(NodeContainer::GetGlobal());
 }
 
-Ptr<FaceContainer>
-StackHelper::Install(Ptr<Node> node) const
+shared_ptr<const nfd::ConfigSection>
+StackHelper::getSharedConfig() const
 {
-  Ptr<FaceContainer> faces = Create<FaceContainer>();
-
-  if (node->GetObject<L3Protocol>() != 0) {
-    NS_FATAL_ERROR("Cannot re-install NDN stack on node "
-                   << node->GetId());
-    return 0;
+  if (m_config != nullptr) {
+    return m_config;
   }
 
-  Ptr<L3Protocol> ndn = m_ndnFactory.Create<L3Protocol>();
+  auto config = make_shared<nfd::ConfigSection>(*L3Protocol::getDefaultConfig());
 
   if (m_isRibManagerDisabled) {
-    ndn->getConfig().put("ndnSIM.disable_rib_manager", true);
+    config->put("ndnSIM.disable_rib_manager", true);
   }
 
   // if (m_isFaceManagerDisabled) {
-  //   ndn->getConfig().put("ndnSIM.disable_face_manager", true);
+  //   config->put("ndnSIM.disable_face_manager", true);
   // }
 
   if (m_isForwarderStatusManagerDisabled) {
-    ndn->getConfig().put("ndnSIM.disable_forwarder_status_manager", true);
+    config->put("ndnSIM.disable_forwarder_status_manager", true);
   }
 
   if (m_isStrategyChoiceManagerDisabled) {
-    ndn->getConfig().put("ndnSIM.disable_strategy_choice_manager", true);
+    config->put("ndnSIM.disable_strategy_choice_manager", true);
+    config->get_child("authorizations").get_child("authorize").get_child("privileges").erase("strategy-choice");
+  }
+
+  if (m_isManagementDisabled) {
+    config->put("ndnSIM.disable_management", true);
   }
 
-  ndn->getConfig().put("tables.cs_max_packets", (m_maxCsSize == 0) ? 1 : m_maxCsSize);
+  config->put("tables.cs_max_packets", (m_maxCsSize == 0) ? 1 : m_maxCsSize);
+
+  m_config = config;
+  return m_config;
+}
+
+Ptr<FaceContainer>
+StackHelper::Install(Ptr<Node> node) const
+{
+  Ptr<FaceContainer> faces = Create<FaceContainer>();
+  doInstall(node, *faces);
+  return faces;
+}
+
+void
+StackHelper::doInstall(Ptr<Node> node, FaceContainer& faces) const
+{
+  if (node->GetObject<L3Protocol>() != 0) {
+    NS_FATAL_ERROR("Cannot re-install NDN stack on node "
+                   << node->GetId());
+    return;
+  }
+
+  Ptr<L3Protocol> ndn = m_ndnFactory.Create<L3Protocol>();
+
+  ndn->setConfig(getSharedConfig());
 
   // Create and aggregate content store if NFD's contest store has been disabled
   if (m_maxCsSize == 0) {
@@ -217,10 +267,8 @@ StackHelper::Install(Ptr<Node> node) const
     // if (DynamicCast<LoopbackNetDevice> (device) != 0)
     //   continue; // don't create face for a LoopbackNetDevice
 
-    faces->Add(this->createAndRegisterFace(node, ndn, device));
+    faces.Add(this->createAndRegisterFace(node, ndn, device));
   }
-
-  return faces;
 }
 
 void
@@ -252,17 +300,81 @@ StackHelper::RemoveFaceCreateCallback(TypeId netDeviceType,
 }
 
 std::string
-constructFaceUri(Ptr<NetDevice> netDevice)
+constructFaceUri(const NetDevice& netDevice)
 {
   std::string uri = "netdev://";
-  Address address = netDevice->GetAddress();
+  Address address = netDevice.GetAddress();
   if (Mac48Address::IsMatchingType(address)) {
-    uri += "[" + boost::lexical_cast<std::string>(Mac48Address::ConvertFrom(address)) + "]";
+    // same as operator<< of Mac48Address, without going through a stream
+    static const char HEX[] = "0123456789abcdef";
+    uint8_t mac[6];
+    Mac48Address::ConvertFrom(address).CopyTo(mac);
+
+    uri += '[';
+    for (int i = 0; i < 6; ++i) {
+      if (i > 0) {
+        uri += ':';
+      }
+      uri += HEX[mac[i] >> 4];
+      uri += HEX[mac[i] & 0x0F];
+    }
+    uri += ']';
   }
 
   return uri;
 }
 
+void
+StackHelper::precomputeFaceUris(const NodeContainer& nodes) const
+{
+  // raw pointers: Ptr reference counting is not thread-safe
+  std::vector<const NetDevice*> devices;
+  for (NodeContainer::Iterator i = nodes.Begin(); i != nodes.End(); ++i) {
+    for (uint32_t index = 0; index < (*i)->GetNDevices(); index++) {
+      devices.push_back(PeekPointer((*i)->GetDevice(index)));
+    }
+  }
+
+  // URI parsing dominates face creation, while it depends only on the device address
+  std::vector<FaceUri> uris(devices.size());
+  auto parse = [&devices, &uris] (size_t begin, size_t end) {
+    for (size_t k = begin; k < end; ++k) {
+      uris[k] = FaceUri(constructFaceUri(*devices[k]));
+    }
+  };
+
+  const size_t MIN_DEVICES_PER_THREAD = 1024;
+  size_t nThreads = std::min<size_t>(m_nInstallThreads, devices.size() / MIN_DEVICES_PER_THREAD);
+  if (nThreads <= 1) {
+    parse(0, devices.size());
+  }
+  else {
+    std::vector<std::thread> workers;
+    size_t chunk = (devices.size() + nThreads - 1) / nThreads;
+    for (size_t begin = 0; begin < devices.size(); begin += chunk) {
+      workers.emplace_back(parse, begin, std::min(begin + chunk, devices.size()));
+    }
+    for (auto& worker : workers) {
+      worker.join();
+    }
+  }
+
+  m_faceUris.reserve(devices.size());
+  for (size_t k = 0; k < devices.size(); ++k) {
+    m_faceUris.emplace(devices[k], std::move(uris[k]));
+  }
+}
+
+FaceUri
+StackHelper::getFaceUri(Ptr<NetDevice> netDevice) const
+{
+  auto uri = m_faceUris.find(PeekPointer(netDevice));
+  if (uri != m_faceUris.end()) {
+    return uri->second;
+  }
+  return FaceUri(constructFaceUri(*netDevice));
+}
+
 
 shared_ptr<Face>
 StackHelper::DefaultNetDeviceCallback(Ptr<Node> node, Ptr<L3Protocol> ndn,
@@ -277,9 +389,9 @@ StackHelper::DefaultNetDeviceCallback(Ptr<Node> node, Ptr<L3Protocol> ndn,
 
   auto linkService = make_unique<::nfd::face::GenericLinkService>(opts);
 
+  static const FaceUri BROADCAST_URI("netdev://[ff:ff:ff:ff:ff:ff]");
   auto transport = make_unique<NetDeviceTransport>(node, netDevice,
-                                                   constructFaceUri(netDevice),
-                                                   "netdev://[ff:ff:ff:ff:ff:ff]");
+                                                   getFaceUri(netDevice), BROADCAST_URI);
 
   auto face = std::make_shared<Face>(std::move(linkService), std::move(transport));
   face->setMetric(1);
@@ -316,8 +428,8 @@ StackHelper::PointToPointNetDeviceCallback(Ptr<Node> node, Ptr<L3Protocol> ndn,
   auto linkService = make_unique<::nfd::face::GenericLinkService>(opts);
 
   auto transport = make_unique<NetDeviceTransport>(node, netDevice,
-                                                   constructFaceUri(netDevice),
-                                                   constructFaceUri(remoteNetDevice));
+                                                   getFaceUri(netDevice),
+                                                   getFaceUri(remoteNetDevice));
 
   auto face = std::make_shared<Face>(std::move(linkService), std::move(transport));
   face->setMetric(1);
@@ -406,6 +518,7 @@ void
 StackHelper::disableRibManager()
 {
   m_isRibManagerDisabled = true;
+  m_config = nullptr;
 }
 
 // void
@@ -418,12 +531,21 @@ void
 StackHelper::disableStrategyChoiceManager()
 {
   m_isStrategyChoiceManagerDisabled = true;
+  m_config = nullptr;
 }
 
 void
 StackHelper::disableForwarderStatusManager()
 {
   m_isForwarderStatusManagerDisabled = true;
+  m_config = nullptr;
+}
+
+void
+StackHelper::disableManagement()
+{
+  m_isManagementDisabled = true;
+  m_config = nullptr;
 }
 
 } // namespace ndn
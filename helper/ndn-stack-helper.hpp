@@ -31,10 +31,16 @@
 #include "ndn-fib-helper.hpp"
 #include "ndn-strategy-choice-helper.hpp"
 
+#include <boost/property_tree/ptree_fwd.hpp>
+
+#include <unordered_map>
+
 namespace nfd {
 namespace cs {
 class Policy;
 } // namespace cs
+
+typedef boost::property_tree::ptree ConfigSection;
 } // namespace nfd
 
 namespace ns3 {
@@ -184,6 +190,15 @@ public:
   Ptr<FaceContainer>
   InstallAll() const;
 
+  /**
+   * \brief Set number of worker threads used by Install(const NodeContainer&) to prepare face
+   *        URIs of all NetDevices (default: number of hardware threads)
+   *
+   * ns-3 and NFD objects are always created on the calling thread
+   */
+  void
+  setInstallThreads(uint32_t nThreads);
+
   /**
    * \brief Set flag indicating necessity to install default routes in FIB
    */
@@ -248,6 +263,17 @@ public:
   void
   disableForwarderStatusManager();
 
+  /**
+   * \brief Install a "bare forwarder" without NFD management
+   *
+   * Internal faces, command dispatchers, authenticator, and all managers (including the RIB
+   * manager) are not created.  FibHelper and StrategyChoiceHelper then modify forwarder tables
+   * directly, while applications cannot register prefixes or issue other management commands.
+   * Intended for large simulations with statically computed routes.
+   */
+  void
+  disableManagement();
+
 private:
   shared_ptr<Face>
   DefaultNetDeviceCallback(Ptr<Node> node, Ptr<L3Protocol> ndn, Ptr<NetDevice> netDevice) const;
@@ -258,10 +284,37 @@ private:
   shared_ptr<Face>
   createAndRegisterFace(Ptr<Node> node, Ptr<L3Protocol> ndn, Ptr<NetDevice> device) const;
 
+  /**
+   * \brief Install stack on @p node and add its faces to @p faces
+   */
+  void
+  doInstall(Ptr<Node> node, FaceContainer& faces) const;
+
+  /**
+   * \brief Parse URIs of all NetDevices on @p nodes in worker threads
+   *
+   * The URIs are used by face create callbacks (getFaceUri) until the end of bulk installation
+   */
+  void
+  precomputeFaceUris(const NodeContainer& nodes) const;
+
+  /**
+   * \brief Get URI of the face created for @p netDevice
+   */
+  FaceUri
+  getFaceUri(Ptr<NetDevice> netDevice) const;
+
+  /**
+   * \brief Get NFD config for the current helper settings, shared by all installed nodes
+   */
+  shared_ptr<const nfd::ConfigSection>
+  getSharedConfig() const;
+
   bool m_isRibManagerDisabled;
   // bool m_isFaceManagerDisabled;
   bool m_isForwarderStatusManagerDisabled;
   bool m_isStrategyChoiceManagerDisabled;
+  bool m_isManagementDisabled;
 
 public:
   void
@@ -274,6 +327,11 @@ private:
   bool m_needSetDefaultRoutes;
   size_t m_maxCsSize;
 
+  mutable shared_ptr<const nfd::ConfigSection> m_config; ///< \brief reset when settings change
+
+  uint32_t m_nInstallThreads;
+  mutable std::unordered_map<const NetDevice*, FaceUri> m_faceUris; ///< \brief during bulk install
+
   typedef std::function<std::unique_ptr<nfd::cs::Policy>()> PolicyCreationCallback;
   PolicyCreationCallback m_csPolicyCreationFunc;
 
@@ -31,6 +31,17 @@ NS_LOG_COMPONENT_DEFINE("ndn.StrategyChoiceHelper");
 void
 StrategyChoiceHelper::sendCommand(const ControlParameters& parameters, Ptr<Node> node)
 {
+  Ptr<L3Protocol> l3protocol = node->GetObject<L3Protocol>();
+  if (!l3protocol->isManagementEnabled()) {
+    // bare forwarder: there is no StrategyChoiceManager to process the command
+    if (!l3protocol->getForwarder()->getStrategyChoice().insert(parameters.getName(),
+                                                                parameters.getStrategy())) {
+      NS_LOG_ERROR("Strategy " << parameters.getStrategy() << " cannot be installed on node "
+                   << node->GetId());
+    }
+    return;
+  }
+
   NS_LOG_DEBUG("Strategy choice command was initialized");
   Block encodedParameters(parameters.wireEncode());
 
@@ -41,7 +52,6 @@ StrategyChoiceHelper::sendCommand(const ControlParameters& parameters, Ptr<Node>
   shared_ptr<Interest> command(make_shared<Interest>(commandName));
   StackHelper::getKeyChain().sign(*command);
 
-  Ptr<L3Protocol> l3protocol = node->GetObject<L3Protocol>();
   l3protocol->injectInterest(*command);
 }
 
@@ -32,6 +32,7 @@
 #include "ns3/string.h"
 
 #include "../../utils/trie/trie-with-policy.hpp"
+#include "../../utils/ndn-profiler.hpp"
 
 namespace ns3 {
 namespace ndn {
@@ -117,6 +118,9 @@ public:
   virtual uint32_t
   GetSize() const;
 
+  virtual TableMemoryUsage
+  GetMemoryUsage() const;
+
   virtual Ptr<Entry>
   Begin();
 
@@ -206,6 +210,7 @@ shared_ptr<Data>
 ContentStoreImpl<Policy>::Lookup(shared_ptr<const Interest> interest)
 {
   NS_LOG_FUNCTION(this << interest->getName());
+  NDNSIM_PROFILE_SCOPE(CS_LOOKUP);
 
   typename super::const_iterator node;
   if (interest->getExclude().empty()) {
@@ -233,6 +238,7 @@ bool
 ContentStoreImpl<Policy>::Add(shared_ptr<const Data> data)
 {
   NS_LOG_FUNCTION(this << data->getName());
+  NDNSIM_PROFILE_SCOPE(CS_INSERT);
 
   Ptr<entry> newEntry = Create<entry>(this, data);
   std::pair<typename super::iterator, bool> result = super::insert(data->getName(), newEntry);
@@ -285,6 +291,32 @@ ContentStoreImpl<Policy>::GetSize() const
   return this->getPolicy().size();
 }
 
+template<class Policy>
+TableMemoryUsage
+ContentStoreImpl<Policy>::GetMemoryUsage() const
+{
+  typedef typename Policy::policy_hook_type policy_hook;
+
+  TableMemoryUsage usage;
+
+  // policy hooks are embedded into trie nodes, account them separately
+  size_t nNodes = super::getTrie().node_count();
+  usage.m_csTrie = super::getTrie().memory_usage() - nNodes * sizeof(policy_hook);
+  usage.m_csPolicy = sizeof(typename super::policy_container) + nNodes * sizeof(policy_hook);
+
+  typename super::parent_trie::const_recursive_iterator item(super::getTrie()), end(0);
+  for (; item != end; item++) {
+    if (item->payload() == 0)
+      continue;
+
+    usage.m_csEntries++;
+    usage.m_csData +=
+      sizeof(entry) + TableMemoryUsage::GetDataMemoryUsage(*item->payload()->GetData());
+  }
+
+  return usage;
+}
+
 template<class Policy>
 Ptr<Entry>
 ContentStoreImpl<Policy>::Begin()
@@ -52,6 +52,12 @@ ContentStore::~ContentStore()
 {
 }
 
+TableMemoryUsage
+ContentStore::GetMemoryUsage() const
+{
+  return TableMemoryUsage();
+}
+
 namespace cs {
 
 //////////////////////////////////////////////////////////////////////
@@ -21,6 +21,7 @@
 #define NDN_CONTENT_STORE_H
 
 #include "ns3/ndnSIM/model/ndn-common.hpp"
+#include "ns3/ndnSIM/utils/ndn-memory-usage.hpp"
 
 #include "ns3/object.h"
 #include "ns3/ptr.h"
@@ -151,6 +152,15 @@ public:
   virtual uint32_t
   GetSize() const = 0;
 
+  /**
+   * @brief Get approximate memory used by content store structures and cached Data packets
+   *
+   * Only content store related fields of the returned TableMemoryUsage are set.  Default
+   * implementation reports no memory usage.
+   */
+  virtual TableMemoryUsage
+  GetMemoryUsage() const;
+
   /**
    * @brief Return first element of content store (no order guaranteed)
    */
@@ -26,6 +26,7 @@
 #include "ns3/simulator.h"
 
 #include "apps/ndn-app.hpp"
+#include "utils/ndn-profiler.hpp"
 
 NS_LOG_COMPONENT_DEFINE("ndn.AppLinkService");
 
@@ -50,6 +51,7 @@ void
 AppLinkService::doSendInterest(const Interest& interest)
 {
   NS_LOG_FUNCTION(this << &interest);
+  NDNSIM_PROFILE_SCOPE(APP_LINK_DISPATCH);
 
   // to decouple callbacks
   Simulator::ScheduleNow(&App::OnInterest, m_app, interest.shared_from_this());
@@ -59,6 +61,7 @@ void
 AppLinkService::doSendData(const Data& data)
 {
   NS_LOG_FUNCTION(this << &data);
+  NDNSIM_PROFILE_SCOPE(APP_LINK_DISPATCH);
 
   // to decouple callbacks
   Simulator::ScheduleNow(&App::OnData, m_app, data.shared_from_this());
@@ -68,6 +71,7 @@ void
 AppLinkService::doSendNack(const lp::Nack& nack)
 {
   NS_LOG_FUNCTION(this << &nack);
+  NDNSIM_PROFILE_SCOPE(APP_LINK_DISPATCH);
 
   // to decouple callbacks
   Simulator::ScheduleNow(&App::OnNack, m_app, make_shared<lp::Nack>(nack));
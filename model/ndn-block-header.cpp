@@ -18,6 +18,7 @@
  **/
 
 #include "ndn-block-header.hpp"
+#include "../utils/ndn-profiler.hpp"
 
 #include <iosfwd>
 #include <boost/iostreams/concepts.hpp>
@@ -70,6 +71,7 @@ BlockHeader::GetSerializedSize(void) const
 void
 BlockHeader::Serialize(ns3::Buffer::Iterator start) const
 {
+  NDNSIM_PROFILE_SCOPE(BLOCK_HEADER_SERIALIZE);
   start.Write(m_block.wire(), m_block.size());
 }
 
@@ -102,6 +104,7 @@ private:
 uint32_t
 BlockHeader::Deserialize(ns3::Buffer::Iterator start)
 {
+  NDNSIM_PROFILE_SCOPE(BLOCK_HEADER_DESERIALIZE);
   io::stream<Ns3BufferIteratorSource> is(start);
   m_block = ::ndn::Block::fromStream(is);
   return m_block.size();
@@ -35,6 +35,7 @@
 #include "cs/ndn-content-store.hpp"
 
 #include <boost/property_tree/info_parser.hpp>
+#include <unordered_map>
 
 #include "ns3/ndnSIM/NFD/daemon/fw/forwarder.hpp"
 #include "ns3/ndnSIM/NFD/daemon/face/internal-face.hpp"
@@ -108,10 +109,86 @@ L3Protocol::GetTypeId(void)
   return tid;
 }
 
-class L3Protocol::Impl {
+/// @cond include_hidden
+namespace {
+
+/**
+ * @brief Tables section of NFD config, parsed once for all nodes sharing the config
+ */
+class TablesConfig
+{
+public:
+  /**
+   * @brief Get tables config for @p config
+   * @return nullptr, if the tables section contains options that have to be processed by
+   *         nfd::TablesConfigSection
+   */
+  static shared_ptr<const TablesConfig>
+  get(const shared_ptr<const nfd::ConfigSection>& config)
+  {
+    // nodes are normally installed with the same config, so a single cached entry is enough
+    static std::weak_ptr<const nfd::ConfigSection> s_config;
+    static shared_ptr<const TablesConfig> s_tables;
+
+    if (s_config.lock() != config) {
+      s_config = config;
+      s_tables = parse(*config);
+    }
+    return s_tables;
+  }
+
+  void
+  apply(nfd::Forwarder& forwarder) const
+  {
+    forwarder.getCs().setLimit(m_csMaxPackets);
+
+    for (const auto& strategy : m_strategies) {
+      if (!forwarder.getStrategyChoice().insert(strategy.first, strategy.second)) {
+        NS_FATAL_ERROR("Cannot set strategy " << strategy.second << " for " << strategy.first);
+      }
+    }
+  }
+
 private:
-  Impl()
+  static shared_ptr<const TablesConfig>
+  parse(const nfd::ConfigSection& config)
   {
+    auto tables = make_shared<TablesConfig>();
+
+    auto section = config.get_child_optional("tables");
+    if (!section) {
+      return tables;
+    }
+
+    for (const auto& option : *section) {
+      if (option.first == "cs_max_packets") {
+        tables->m_csMaxPackets = option.second.get_value<size_t>();
+      }
+      else if (option.first == "strategy_choice") {
+        for (const auto& choice : option.second) {
+          tables->m_strategies.push_back({Name(choice.first),
+                                          Name(choice.second.get_value<std::string>())});
+        }
+      }
+      else {
+        return nullptr;
+      }
+    }
+    return tables;
+  }
+
+private:
+  size_t m_csMaxPackets = 65536; // nfd::TablesConfigSection::DEFAULT_CS_MAX_PACKETS
+  std::vector<std::pair<Name, Name>> m_strategies;
+};
+
+} // namespace
+/// @endcond
+
+shared_ptr<const nfd::ConfigSection>
+L3Protocol::getDefaultConfig()
+{
+  static shared_ptr<const nfd::ConfigSection> config = [] {
     // Do not modify initial config file. Use helpers to set specific NFD parameters
     std::string initialConfig =
       "general\n"
@@ -161,8 +238,20 @@ private:
       "}\n"
       "\n";
 
+    auto section = make_shared<nfd::ConfigSection>();
     std::istringstream input(initialConfig);
-    boost::property_tree::read_info(input, m_config);
+    boost::property_tree::read_info(input, *section);
+    return section;
+  }();
+
+  return config;
+}
+
+class L3Protocol::Impl {
+private:
+  Impl()
+    : m_config(L3Protocol::getDefaultConfig())
+  {
   }
 
   friend class L3Protocol;
@@ -184,10 +273,16 @@ private:
   std::shared_ptr<nfd::ForwarderStatusManager> m_forwarderStatusManager;
   std::shared_ptr<nfd::rib::RibManager> m_ribManager;
 
-  nfd::ConfigSection m_config;
+  shared_ptr<const nfd::ConfigSection> m_config;
+  shared_ptr<nfd::ConfigSection> m_ownConfig; ///< @brief set once m_config is copied for this node
 
   Ptr<ContentStore> m_csFromNdnSim;
   PolicyCreationCallback m_policy;
+
+  /**
+   * @brief Index of NetDevice-based faces, maintained by addFace and FaceTable::beforeRemove
+   */
+  std::unordered_map<const NetDevice*, Face*> m_netDeviceFaces;
 };
 
 L3Protocol::L3Protocol()
@@ -206,13 +301,28 @@ L3Protocol::initialize()
 {
   m_impl->m_forwarder = make_shared<nfd::Forwarder>();
 
-  initializeManagement();
+  bool isManagementDisabled = readConfig().get<bool>("ndnSIM.disable_management", false);
+  if (!isManagementDisabled) {
+    initializeManagement();
+  }
+  else {
+    initializeTables();
+  }
 
   nfd::FaceTable& faceTable = m_impl->m_forwarder->getFaceTable();
   faceTable.addReserved(nfd::face::makeNullFace(), nfd::face::FACEID_NULL);
   faceTable.addReserved(nfd::face::makeNullFace(FaceUri("contentstore://")), nfd::face::FACEID_CONTENT_STORE);
+  faceTable.beforeRemove.connect([this] (Face& face) {
+      auto transport = dynamic_cast<NetDeviceTransport*>(face.getTransport());
+      if (transport != nullptr) {
+        auto i = m_impl->m_netDeviceFaces.find(PeekPointer(transport->GetNetDevice()));
+        if (i != m_impl->m_netDeviceFaces.end() && i->second == &face) {
+          m_impl->m_netDeviceFaces.erase(i);
+        }
+      }
+    });
 
-  if (!this->getConfig().get<bool>("ndnSIM.disable_rib_manager", false)) {
+  if (!isManagementDisabled && !readConfig().get<bool>("ndnSIM.disable_rib_manager", false)) {
     Simulator::ScheduleWithContext(m_node->GetId(), Seconds(0), &L3Protocol::initializeRibManager, this);
   }
 
@@ -244,6 +354,8 @@ private:
 void
 L3Protocol::injectInterest(const Interest& interest)
 {
+  NS_ASSERT_MSG(m_impl->m_internalFace != nullptr,
+                "NFD management is disabled on node " << m_node->GetId());
   m_impl->m_internalFace->sendInterest(interest);
 }
 
@@ -280,30 +392,23 @@ L3Protocol::initializeManagement()
   //   this->getConfig().get_child("authorizations").get_child("authorize").get_child("privileges").erase("faces");
   // }
 
-  if (!this->getConfig().get<bool>("ndnSIM.disable_strategy_choice_manager", false)) {
+  if (!readConfig().get<bool>("ndnSIM.disable_strategy_choice_manager", false)) {
     m_impl->m_strategyChoiceManager.reset(new StrategyChoiceManager(forwarder->getStrategyChoice(),
                                                                     *m_impl->m_dispatcher,
                                                                     *m_impl->m_authenticator));
   }
-  else {
+  else if (readConfig().get_child_optional("authorizations.authorize.privileges.strategy-choice")) {
+    // StackHelper removes the privilege in the shared config, so the config is copied only if
+    // the option was set directly on this node
     this->getConfig().get_child("authorizations").get_child("authorize").get_child("privileges").erase("strategy-choice");
   }
 
-  if (!this->getConfig().get<bool>("ndnSIM.disable_forwarder_status_manager", false)) {
+  if (!readConfig().get<bool>("ndnSIM.disable_forwarder_status_manager", false)) {
     m_impl->m_forwarderStatusManager.reset(new ForwarderStatusManager(*forwarder, *m_impl->m_dispatcher));
   }
 
   ConfigFile config(&ConfigFile::ignoreUnknownSection);
 
-  // if we use NFD's CS, we have to specify a replacement policy
-  m_impl->m_csFromNdnSim = GetObject<ContentStore>();
-  if (m_impl->m_csFromNdnSim == nullptr) {
-    forwarder->getCs().setPolicy(m_impl->m_policy());
-  }
-
-  TablesConfigSection tablesConfig(*forwarder);
-  tablesConfig.setConfigFile(config);
-
   m_impl->m_authenticator->setConfigFile(config);
 
   // if (!this->getConfig().get<bool>("ndnSIM.disable_face_manager", false)) {
@@ -311,9 +416,9 @@ L3Protocol::initializeManagement()
   // }
 
   // apply config
-  config.parse(m_impl->m_config, false, "ndnSIM.conf");
+  config.parse(*m_impl->m_config, false, "ndnSIM.conf");
 
-  tablesConfig.ensureConfigured();
+  initializeTables();
 
   // add FIB entry for NFD Management Protocol
   Name topPrefix("/localhost/nfd");
@@ -322,6 +427,36 @@ L3Protocol::initializeManagement()
   m_impl->m_dispatcher->addTopPrefix(topPrefix, false);
 }
 
+void
+L3Protocol::initializeTables()
+{
+  auto& forwarder = m_impl->m_forwarder;
+  using namespace nfd;
+
+  // if we use NFD's CS, we have to specify a replacement policy
+  m_impl->m_csFromNdnSim = GetObject<ContentStore>();
+  if (m_impl->m_csFromNdnSim == nullptr) {
+    forwarder->getCs().setPolicy(m_impl->m_policy());
+  }
+
+  shared_ptr<const TablesConfig> tables = TablesConfig::get(m_impl->m_config);
+  if (tables != nullptr) {
+    tables->apply(*forwarder);
+    return;
+  }
+
+  // tables section has options not covered by TablesConfig
+  ConfigFile config(&ConfigFile::ignoreUnknownSection);
+
+  TablesConfigSection tablesConfig(*forwarder);
+  tablesConfig.setConfigFile(config);
+
+  // apply config
+  config.parse(*m_impl->m_config, false, "ndnSIM.conf");
+
+  tablesConfig.ensureConfigured();
+}
+
 void
 L3Protocol::initializeRibManager()
 {
@@ -351,7 +486,7 @@ L3Protocol::initializeRibManager()
   m_impl->m_ribManager->setConfigFile(config);
 
   // apply config
-  config.parse(m_impl->m_config, false, "ndnSIM.conf");
+  config.parse(*m_impl->m_config, false, "ndnSIM.conf");
 
   m_impl->m_ribManager->registerWithNfd();
 }
@@ -362,6 +497,12 @@ L3Protocol::getForwarder()
   return m_impl->m_forwarder;
 }
 
+bool
+L3Protocol::isManagementEnabled() const
+{
+  return m_impl->m_internalFace != nullptr;
+}
+
 shared_ptr<nfd::FibManager>
 L3Protocol::getFibManager()
 {
@@ -377,7 +518,26 @@ L3Protocol::getStrategyChoiceManager()
 nfd::ConfigSection&
 L3Protocol::getConfig()
 {
-  return m_impl->m_config;
+  if (m_impl->m_ownConfig == nullptr) {
+    m_impl->m_ownConfig = make_shared<nfd::ConfigSection>(*m_impl->m_config);
+    m_impl->m_config = m_impl->m_ownConfig;
+  }
+  return *m_impl->m_ownConfig;
+}
+
+void
+L3Protocol::setConfig(shared_ptr<const nfd::ConfigSection> config)
+{
+  NS_ASSERT_MSG(m_node == nullptr, "Config cannot be replaced after the stack is installed");
+
+  m_impl->m_config = std::move(config);
+  m_impl->m_ownConfig = nullptr;
+}
+
+const nfd::ConfigSection&
+L3Protocol::readConfig() const
+{
+  return *m_impl->m_config;
 }
 
 /*
@@ -425,6 +585,11 @@ L3Protocol::addFace(shared_ptr<Face> face)
 
   m_impl->m_forwarder->addFace(face);
 
+  auto transport = dynamic_cast<NetDeviceTransport*>(face->getTransport());
+  if (transport != nullptr) {
+    m_impl->m_netDeviceFaces[PeekPointer(transport->GetNetDevice())] = face.get();
+  }
+
   std::weak_ptr<Face> weakFace = face;
 
   // // Connect Signals to TraceSource
@@ -484,15 +649,11 @@ L3Protocol::getFaceById(nfd::FaceId id) const
 shared_ptr<Face>
 L3Protocol::getFaceByNetDevice(Ptr<NetDevice> netDevice) const
 {
-  for (auto& i : m_impl->m_forwarder->getFaceTable()) {
-    auto transport = dynamic_cast<NetDeviceTransport*>(i.getTransport());
-    if (transport == nullptr)
-      continue;
+  auto i = m_impl->m_netDeviceFaces.find(PeekPointer(netDevice));
+  if (i == m_impl->m_netDeviceFaces.end())
+    return nullptr;
 
-    if (transport->GetNetDevice() == netDevice)
-      return i.shared_from_this();
-  }
-  return nullptr;
+  return i->second->shared_from_this();
 }
 
 Ptr<L3Protocol>
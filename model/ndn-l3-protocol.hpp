@@ -101,6 +101,15 @@ public:
   shared_ptr<nfd::Forwarder>
   getForwarder();
 
+  /**
+   * \brief Check whether NFD management (internal face, dispatcher, and managers) is available
+   *
+   * Management is not created for the "bare forwarder" stack (StackHelper::disableManagement),
+   * in which case helpers modify forwarder tables directly
+   */
+  bool
+  isManagementEnabled() const;
+
   /**
    * \brief Get smart pointer to nfd::FibManager, used by node's NFD
    */
@@ -140,18 +149,42 @@ public:
 
   /**
    * \brief Get face for NetDevice
+   *
+   * Faces are indexed by NetDevice when added with addFace, so the lookup does not depend on
+   * the number of faces on the node
+   *
+   * \return face, or nullptr if there is no face associated with @p netDevice
    */
   shared_ptr<Face>
   getFaceByNetDevice(Ptr<NetDevice> netDevice) const;
 
   /**
    * \brief Get NFD config (boost::property_tree)
+   *
+   * If the config is shared with other nodes (see setConfig), it is copied first, so that
+   * modifications apply only to this node
    */
   nfd::ConfigSection&
   getConfig();
 
+  /**
+   * \brief Share read-only NFD config with other nodes
+   *
+   * Must be called before the stack is aggregated to the node.  The config is copied only if
+   * getConfig() is called afterwards.
+   */
+  void
+  setConfig(shared_ptr<const nfd::ConfigSection> config);
+
+  /**
+   * \brief Get the default NFD config, parsed once and shared by all nodes that do not modify it
+   */
+  static shared_ptr<const nfd::ConfigSection>
+  getDefaultConfig();
+
   /**
    * \brief Inject interest through internal Face
+   * \pre isManagementEnabled()
    */
   void
   injectInterest(const Interest& interest);
@@ -195,6 +228,18 @@ private:
   void
   initializeManagement();
 
+  /**
+   * \brief Set CS replacement policy and apply tables section of the config
+   */
+  void
+  initializeTables();
+
+  /**
+   * \brief Get config for reading, without copying the shared one
+   */
+  const nfd::ConfigSection&
+  readConfig() const;
+
   void
   initializeRibManager();
 
@@ -22,6 +22,7 @@
 #include "../helper/ndn-stack-helper.hpp"
 #include "ndn-block-header.hpp"
 #include "../utils/ndn-ns3-packet-tag.hpp"
+#include "../utils/ndn-profiler.hpp"
 
 #include <ndn-cxx/encoding/block.hpp>
 #include <ndn-cxx/interest.hpp>
@@ -39,11 +40,23 @@ NetDeviceTransport::NetDeviceTransport(Ptr<Node> node,
                                        ::ndn::nfd::FaceScope scope,
                                        ::ndn::nfd::FacePersistency persistency,
                                        ::ndn::nfd::LinkType linkType)
+  : NetDeviceTransport(node, netDevice, FaceUri(localUri), FaceUri(remoteUri), scope,
+                       persistency, linkType)
+{
+}
+
+NetDeviceTransport::NetDeviceTransport(Ptr<Node> node,
+                                       const Ptr<NetDevice>& netDevice,
+                                       const FaceUri& localUri,
+                                       const FaceUri& remoteUri,
+                                       ::ndn::nfd::FaceScope scope,
+                                       ::ndn::nfd::FacePersistency persistency,
+                                       ::ndn::nfd::LinkType linkType)
   : m_netDevice(netDevice)
   , m_node(node)
 {
-  this->setLocalUri(FaceUri(localUri));
-  this->setRemoteUri(FaceUri(remoteUri));
+  this->setLocalUri(localUri);
+  this->setRemoteUri(remoteUri);
   this->setScope(scope);
   this->setPersistency(persistency);
   this->setLinkType(linkType);
@@ -87,6 +100,7 @@ NetDeviceTransport::doSend(Packet&& packet)
 {
   NS_LOG_FUNCTION(this << "Sending packet from netDevice with URI"
                   << this->getLocalUri());
+  NDNSIM_PROFILE_SCOPE(NETDEVICE_SEND);
 
   // convert NFD packet to NS3 packet
   BlockHeader header(packet);
@@ -108,6 +122,7 @@ NetDeviceTransport::receiveFromNetDevice(Ptr<NetDevice> device,
                                       NetDevice::PacketType packetType)
 {
   NS_LOG_FUNCTION(device << p << protocol << from << to << packetType);
+  NDNSIM_PROFILE_SCOPE(NETDEVICE_RECEIVE);
 
   // Convert NS3 packet to NFD packet
   Ptr<ns3::Packet> packet = p->Copy();
@@ -49,6 +49,16 @@ public:
                      ::ndn::nfd::FacePersistency persistency = ::ndn::nfd::FACE_PERSISTENCY_PERSISTENT,
                      ::ndn::nfd::LinkType linkType = ::ndn::nfd::LINK_TYPE_POINT_TO_POINT);
 
+  /**
+   * \brief Create transport with already parsed face URIs (e.g., shared by many transports)
+   */
+  NetDeviceTransport(Ptr<Node> node, const Ptr<NetDevice>& netDevice,
+                     const FaceUri& localUri,
+                     const FaceUri& remoteUri,
+                     ::ndn::nfd::FaceScope scope = ::ndn::nfd::FACE_SCOPE_NON_LOCAL,
+                     ::ndn::nfd::FacePersistency persistency = ::ndn::nfd::FACE_PERSISTENCY_PERSISTENT,
+                     ::ndn::nfd::LinkType linkType = ::ndn::nfd::LINK_TYPE_POINT_TO_POINT);
+
   ~NetDeviceTransport();
 
   Ptr<NetDevice>
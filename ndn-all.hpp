@@ -24,16 +24,22 @@
 #include "ns3/ndnSIM/helper/ndn-app-helper.hpp"
 #include "ns3/ndnSIM/helper/ndn-global-routing-helper.hpp"
 #include "ns3/ndnSIM/helper/ndn-network-region-table-helper.hpp"
+#include "ns3/ndnSIM/helper/ndn-partition-helper.hpp"
 // #include "ns3/ndnSIM/helper/ndn-ip-faces-helper.hpp"
 // #include "ns3/ndnSIM/helper/ndn-link-control-helper.hpp"
 
 #include "ns3/ndnSIM/utils/topology/annotated-topology-reader.hpp"
 #include "ns3/ndnSIM/utils/topology/rocketfuel-map-reader.hpp"
 #include "ns3/ndnSIM/utils/topology/rocketfuel-weights-reader.hpp"
+#include "ns3/ndnSIM/utils/topology/topology-generator.hpp"
 #include "ns3/ndnSIM/utils/tracers/l2-rate-tracer.hpp"
 #include "ns3/ndnSIM/utils/tracers/ndn-app-delay-tracer.hpp"
 #include "ns3/ndnSIM/utils/tracers/ndn-cs-tracer.hpp"
 #include "ns3/ndnSIM/utils/tracers/ndn-l3-rate-tracer.hpp"
+#include "ns3/ndnSIM/utils/tracers/ndn-memory-tracer.hpp"
+#include "ns3/ndnSIM/utils/tracers/ndn-path-stretch-tracer.hpp"
+#include "ns3/ndnSIM/utils/ndn-profiler.hpp"
+#include "ns3/ndnSIM/utils/ndn-sweep-runner.hpp"
 
 // #include "ns3/ndnSIM/model/ndn-app-face.hpp"
 #include "ns3/ndnSIM/model/ndn-l3-protocol.hpp"
@@ -0,0 +1,244 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "apps/ndn-consumer-pipeline.hpp"
+#include "ns3/ndnSIM/helper/ndn-app-helper.hpp"
+
+#include <ndn-cxx/face.hpp>
+
+#include "../tests-common.hpp"
+
+#include <set>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @brief Producer on top of ndn-cxx Face that either answers an Interest or Nacks it
+ */
+class TestPipelineProducer
+{
+public:
+  typedef std::function<bool(const Interest&)> NackPredicate;
+
+  TestPipelineProducer(const Name& prefix, const Name::Component& finalBlockId,
+                       const NackPredicate& shouldNack)
+  {
+    m_face.setInterestFilter(prefix,
+                             [=] (const ::ndn::InterestFilter&, const Interest& interest) {
+                               if (shouldNack(interest)) {
+                                 m_face.put(lp::Nack(interest));
+                                 return;
+                               }
+                               auto data = make_shared<Data>(interest.getName());
+                               if (!finalBlockId.empty()) {
+                                 data->setFinalBlockId(finalBlockId);
+                               }
+                               StackHelper::getKeyChain().sign(*data);
+                               m_face.put(*data);
+                             },
+                             [] (const Name&, const std::string&) {
+                               BOOST_ERROR("Unexpected failure to set interest filter");
+                             });
+  }
+
+private:
+  ::ndn::Face m_face;
+};
+
+class ConsumerPipelineFixture : public ScenarioHelperWithCleanupFixture
+{
+public:
+  ConsumerPipelineFixture()
+    : nDecreases(0)
+    , maxWindow(0)
+    , nSegmentNames(0)
+    , maxSegment(0)
+  {
+    // bottleneck with a small queue, slow start overflows it
+    Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("1Mbps"));
+    Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("10ms"));
+    Config::SetDefault("ns3::DropTailQueue::MaxPackets", StringValue("20"));
+
+    createTopology({
+        {"1", "2"}
+      });
+
+    addRoutes({
+        {"1", "2", "/prefix", 1}
+      });
+  }
+
+  void
+  run(const std::string& algorithm, const std::string& segmented)
+  {
+    addApps({
+        {"2", "ns3::ndn::Producer",
+            {{"Prefix", "/prefix"}, {"PayloadSize", "1024"}},
+            "0s", "30s"}
+      });
+    runConsumer(algorithm, segmented, 500);
+  }
+
+  void
+  runWithTestProducer(const std::string& segmented, uint32_t maxSeq,
+                      const Name::Component& finalBlockId,
+                      const TestPipelineProducer::NackPredicate& shouldNack)
+  {
+    FactoryCallbackApp::Install(getNode("2"), [=] () -> shared_ptr<void> {
+        return make_shared<TestPipelineProducer>("/prefix", finalBlockId, shouldNack);
+      })
+      .Start(Seconds(0.01));
+
+    runConsumer("AIMD", segmented, maxSeq);
+  }
+
+  void
+  runConsumer(const std::string& algorithm, const std::string& segmented, uint32_t maxSeq)
+  {
+    addApps({
+        {"1", "ns3::ndn::ConsumerPipeline",
+            {{"Prefix", "/prefix"}, {"MaxSeq", std::to_string(maxSeq)},
+             {"CcAlgorithm", algorithm}, {"Segmented", segmented}},
+            "0.1s", "30s"}
+      });
+
+    std::string app = "/NodeList/" + std::to_string(getNode("1")->GetId()) + "/ApplicationList/0/";
+    Config::ConnectWithoutContext(app + "CongestionWindow",
+                                  MakeCallback(&ConsumerPipelineFixture::onWindow, this));
+    Config::ConnectWithoutContext(app + "FirstInterestDataDelay",
+                                  MakeCallback(&ConsumerPipelineFixture::onData, this));
+    Config::ConnectWithoutContext(app + "TransmittedInterests",
+                                  MakeCallback(&ConsumerPipelineFixture::onInterest, this));
+    Config::ConnectWithoutContext(app + "ReceivedNacks",
+                                  MakeCallback(&ConsumerPipelineFixture::onNack, this));
+
+    Simulator::Stop(Seconds(30));
+    Simulator::Run();
+  }
+
+  void
+  onWindow(double oldValue, double newValue)
+  {
+    if (newValue < oldValue) {
+      ++nDecreases;
+    }
+    maxWindow = std::max(maxWindow, newValue);
+  }
+
+  void
+  onData(Ptr<App>, uint32_t seq, Time, uint32_t, int32_t)
+  {
+    receivedSeqs.insert(seq);
+  }
+
+  void
+  onInterest(shared_ptr<const Interest> interest, Ptr<App>, shared_ptr<Face>)
+  {
+    const name::Component& last = interest->getName().at(-1);
+    if (last.isSegment()) {
+      ++nSegmentNames;
+      maxSegment = std::max(maxSegment, last.toSegment());
+    }
+    interestTimes.push_back(Simulator::Now());
+  }
+
+  void
+  onNack(shared_ptr<const lp::Nack>, Ptr<App>, shared_ptr<Face>)
+  {
+    nackTimes.push_back(Simulator::Now());
+  }
+
+public:
+  std::set<uint32_t> receivedSeqs;
+  uint32_t nDecreases;
+  double maxWindow;
+  uint32_t nSegmentNames;
+  uint64_t maxSegment;
+  std::vector<Time> interestTimes;
+  std::vector<Time> nackTimes;
+};
+
+BOOST_FIXTURE_TEST_SUITE(AppsNdnConsumerPipeline, ConsumerPipelineFixture)
+
+BOOST_AUTO_TEST_CASE(Aimd)
+{
+  run("AIMD", "false");
+
+  BOOST_CHECK_EQUAL(receivedSeqs.size(), 500);
+  BOOST_CHECK_EQUAL(*receivedSeqs.rbegin(), 499);
+  BOOST_CHECK_GT(maxWindow, 20);   // slow start went beyond the queue size
+  BOOST_CHECK_GT(nDecreases, 0);   // and reacted to the losses
+  BOOST_CHECK_EQUAL(nSegmentNames, 0);
+}
+
+BOOST_AUTO_TEST_CASE(Cubic)
+{
+  run("CUBIC", "false");
+
+  BOOST_CHECK_EQUAL(receivedSeqs.size(), 500);
+  BOOST_CHECK_GT(nDecreases, 0);
+}
+
+BOOST_AUTO_TEST_CASE(Segmented)
+{
+  run("AIMD", "true");
+
+  BOOST_CHECK_EQUAL(receivedSeqs.size(), 500);
+  BOOST_CHECK_GE(nSegmentNames, 500);
+}
+
+BOOST_AUTO_TEST_CASE(FinalBlockIdBelowMaxSeq)
+{
+  runWithTestProducer("true", 500, name::Component::fromSegment(99),
+                      [] (const Interest&) { return false; });
+
+  BOOST_CHECK_EQUAL(receivedSeqs.size(), 100);
+  BOOST_CHECK_EQUAL(*receivedSeqs.rbegin(), 99);
+  // the first Data arrives while only segment 0 is outstanding, nothing goes past FinalBlockId
+  BOOST_CHECK_EQUAL(maxSegment, 99);
+}
+
+BOOST_AUTO_TEST_CASE(NackBackoff)
+{
+  // Nack the first transmission of segments 10..15, all sent within one window
+  std::set<uint64_t> nacked;
+  runWithTestProducer("true", 40, name::Component(),
+                      [&nacked] (const Interest& interest) {
+                        uint64_t segment = interest.getName().at(-1).toSegment();
+                        return segment >= 10 && segment <= 15 && nacked.insert(segment).second;
+                      });
+
+  BOOST_CHECK_EQUAL(nacked.size(), 6);
+  BOOST_CHECK_EQUAL(nackTimes.size(), 6);
+  BOOST_CHECK_EQUAL(receivedSeqs.size(), 40);
+  BOOST_CHECK_EQUAL(nDecreases, 1); // one decrease for the whole window of Nacks
+
+  // no Interest leaves within the initial back-off (NackBackoff=10ms) after any Nack
+  for (const Time& nackTime : nackTimes) {
+    for (const Time& interestTime : interestTimes) {
+      BOOST_CHECK(interestTime <= nackTime || interestTime >= nackTime + MilliSeconds(10));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
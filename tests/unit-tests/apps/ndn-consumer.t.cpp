@@ -0,0 +1,138 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "apps/ndn-consumer.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class ConsumerFixture : public ScenarioHelperWithCleanupFixture
+{
+public:
+  ConsumerFixture()
+    : nRetxChecks(0)
+  {
+    Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("10Mbps"));
+    Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("10ms"));
+    Config::SetDefault("ns3::DropTailQueue::MaxPackets", StringValue("20"));
+
+    createTopology({
+        {"1", "2"}
+      });
+
+    addRoutes({
+        {"1", "2", "/prefix", 1}
+      });
+  }
+
+  /**
+   * @param isAnswered whether node 2 runs a producer; if not, the only Interest is
+   *        retransmitted on every timeout
+   */
+  uint64_t
+  run(bool onDemand, bool isAnswered = false)
+  {
+    addApps({
+        {"1", "ns3::ndn::ConsumerCbr",
+            {{"Prefix", "/prefix"}, {"Frequency", "1"}, {"MaxSeq", "1"},
+             {"RetxTimerOnDemand", onDemand ? "true" : "false"}},
+            "0s", "10s"}
+      });
+    if (isAnswered) {
+      addApps({
+          {"2", "ns3::ndn::Producer", {{"Prefix", "/prefix"}}, "0s", "10s"}
+        });
+    }
+    Ptr<Application> consumer = getNode("1")->GetApplication(0);
+
+    uint64_t nInterests = 0;
+    consumer->TraceConnectWithoutContext("TransmittedInterests",
+                                         MakeBoundCallback(&ConsumerFixture::countInterest,
+                                                           &nInterests));
+    consumer->TraceConnectWithoutContext("RetxCheck",
+                                         MakeCallback(&ConsumerFixture::onRetxCheck, this));
+
+    Simulator::Stop(Seconds(9.5));
+    Simulator::Run();
+    return nInterests;
+  }
+
+  static void
+  countInterest(uint64_t* counter, shared_ptr<const Interest>, Ptr<App>, shared_ptr<Face>)
+  {
+    ++*counter;
+  }
+
+  void
+  onRetxCheck(Ptr<App>)
+  {
+    ++nRetxChecks;
+    lastRetxCheck = Simulator::Now();
+  }
+
+public:
+  uint64_t nRetxChecks;
+  Time lastRetxCheck;
+};
+
+BOOST_FIXTURE_TEST_SUITE(AppsNdnConsumer, ConsumerFixture)
+
+BOOST_AUTO_TEST_CASE(PeriodicRetxTimer)
+{
+  // the only Interest is retransmitted after each (exponentially growing) timeout
+  uint64_t nInterests = run(false);
+  BOOST_CHECK_GT(nInterests, 2);
+  BOOST_CHECK_LT(nInterests, 10);
+
+  // checked every RetxTimer (50ms), regardless of the deadlines
+  BOOST_CHECK_GT(nRetxChecks, 150);
+}
+
+BOOST_AUTO_TEST_CASE(OnDemandRetxTimer)
+{
+  uint64_t nInterests = run(true);
+  BOOST_CHECK_GT(nInterests, 2);
+  BOOST_CHECK_LT(nInterests, 10);
+
+  // checked only around the deadlines of the retransmissions
+  BOOST_CHECK_GE(nRetxChecks, nInterests - 1);
+  BOOST_CHECK_LT(nRetxChecks, 2 * nInterests);
+}
+
+BOOST_AUTO_TEST_CASE(IdleConsumer)
+{
+  // the only Interest is answered, nothing is outstanding afterwards
+  BOOST_CHECK_EQUAL(run(false, true), 1);
+  // still checked every RetxTimer until the end of the run
+  BOOST_CHECK_GT(nRetxChecks, 150);
+  BOOST_CHECK_GE(lastRetxCheck, Seconds(9.4));
+}
+
+BOOST_AUTO_TEST_CASE(IdleOnDemandConsumer)
+{
+  BOOST_CHECK_EQUAL(run(true, true), 1);
+  BOOST_CHECK_EQUAL(nRetxChecks, 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
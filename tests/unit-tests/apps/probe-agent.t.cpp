@@ -0,0 +1,217 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "apps/probe-agent.hpp"
+
+#include "ns3/mobility-module.h"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class TestProbeAgent : public ProbeAgent
+{
+public:
+  using ProbeAgent::m_bindings;
+};
+
+class ProbeAgentFixture : public ScenarioHelperWithCleanupFixture
+{
+public:
+  ProbeAgentFixture()
+  {
+    createTopology({
+        {"1", "2"}
+      });
+
+    GlobalRoutingHelper ndnGlobalRoutingHelper;
+    ndnGlobalRoutingHelper.InstallAll();
+
+    agent = CreateObject<TestProbeAgent>();
+    getNode("1")->AddApplication(agent);
+    agent->SetStartTime(Seconds(0));
+
+    Simulator::Stop(Seconds(1));
+    Simulator::Run();
+  }
+
+  void
+  send(const Name& command)
+  {
+    agent->OnInterest(make_shared<Interest>(command));
+  }
+
+public:
+  Ptr<TestProbeAgent> agent;
+};
+
+BOOST_FIXTURE_TEST_SUITE(AppsProbeAgent, ProbeAgentFixture)
+
+BOOST_AUTO_TEST_CASE(OneComponentNames)
+{
+  send("/ha0/register/prod/loc3");
+
+  BOOST_REQUIRE_EQUAL(agent->m_bindings.GetSize(), 1);
+  const BindingTable::Binding* binding = agent->m_bindings.FindExactMatch("/prod");
+  BOOST_REQUIRE(binding != nullptr);
+  BOOST_CHECK_EQUAL(binding->locator, Name("/loc3"));
+  BOOST_CHECK(binding->expiry == Time::Max());
+
+  Name command("/ha0/update");
+  command.append(ProbeAgent::MakeLifetimeComponent(Seconds(2)));
+  command.append("prod").append("loc4");
+  send(command);
+
+  BOOST_REQUIRE_EQUAL(agent->m_bindings.GetSize(), 1);
+  binding = agent->m_bindings.FindExactMatch("/prod");
+  BOOST_REQUIRE(binding != nullptr);
+  BOOST_CHECK_EQUAL(binding->locator, Name("/loc4"));
+  BOOST_CHECK(binding->expiry == Simulator::Now() + Seconds(2));
+}
+
+BOOST_AUTO_TEST_CASE(BatchedCommand)
+{
+  Name command("/ha0/register");
+  command.append(ProbeAgent::MakeLifetimeComponent(Seconds(2)));
+  ProbeAgent::AppendCommandName(command, "/prod/video");
+  ProbeAgent::AppendCommandName(command, "/loc3");
+  ProbeAgent::AppendCommandName(command, "/prod/audio/hd");
+  ProbeAgent::AppendCommandName(command, "/loc1");
+  send(command);
+
+  BOOST_REQUIRE_EQUAL(agent->m_bindings.GetSize(), 2);
+  const BindingTable::Binding* binding = agent->m_bindings.FindExactMatch("/prod/video");
+  BOOST_REQUIRE(binding != nullptr);
+  BOOST_CHECK_EQUAL(binding->locator, Name("/loc3"));
+  BOOST_CHECK(binding->expiry == Simulator::Now() + Seconds(2));
+
+  binding = agent->m_bindings.FindExactMatch("/prod/audio/hd");
+  BOOST_REQUIRE(binding != nullptr);
+  BOOST_CHECK_EQUAL(binding->locator, Name("/loc1"));
+
+  Name unregister("/ha0/unregister");
+  ProbeAgent::AppendCommandName(unregister, "/prod/video");
+  send(unregister);
+
+  BOOST_CHECK_EQUAL(agent->m_bindings.GetSize(), 1);
+  BOOST_CHECK(agent->m_bindings.FindExactMatch("/prod/video") == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(MalformedCommands)
+{
+  // no bindings
+  send("/ha0/register");
+  send("/ha0/register/lifetime=1000");
+
+  // prefix without locator, in the middle of the batch
+  send("/ha0/register/prod/loc3/other");
+
+  // invalid lifetime is a prefix, which leaves a prefix without locator
+  send("/ha0/register/lifetime=1s/prod/loc3");
+
+  BOOST_CHECK_EQUAL(agent->m_bindings.GetSize(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(NonceComponent)
+{
+  Name command("/ha0/register");
+  command.append(ProbeAgent::MakeLifetimeComponent(Seconds(2)));
+  command.append(ProbeAgent::MakeNonceComponent(42));
+  ProbeAgent::AppendCommandName(command, "/prod");
+  ProbeAgent::AppendCommandName(command, "/loc3");
+  send(command);
+
+  BOOST_REQUIRE_EQUAL(agent->m_bindings.GetSize(), 1);
+  const BindingTable::Binding* binding = agent->m_bindings.FindExactMatch("/prod");
+  BOOST_REQUIRE(binding != nullptr);
+  BOOST_CHECK_EQUAL(binding->locator, Name("/loc3"));
+
+  Name unregister("/ha0/unregister");
+  unregister.append(ProbeAgent::MakeNonceComponent(43));
+  ProbeAgent::AppendCommandName(unregister, "/prod");
+  send(unregister);
+
+  BOOST_CHECK_EQUAL(agent->m_bindings.GetSize(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+class ProbeAgentRefreshFixture : public ScenarioHelperWithCleanupFixture
+{
+public:
+  ProbeAgentRefreshFixture()
+    : nCommands(0)
+  {
+    createTopology({
+        {"1", "2"}
+      });
+    getNode("2")->AggregateObject(CreateObject<ConstantPositionMobilityModel>());
+
+    GlobalRoutingHelper ndnGlobalRoutingHelper;
+    ndnGlobalRoutingHelper.InstallAll();
+    ndnGlobalRoutingHelper.AddOrigin("/ha0", getNode("1"));
+    GlobalRoutingHelper::CalculateRoutes();
+
+    agent = CreateObject<TestProbeAgent>();
+    getNode("1")->AddApplication(agent);
+    agent->SetStartTime(Seconds(0));
+    agent->TraceConnectWithoutContext("ReceivedInterests",
+                                      MakeCallback(&ProbeAgentRefreshFixture::onCommand, this));
+  }
+
+  void
+  onCommand(shared_ptr<const Interest>, Ptr<App>, shared_ptr<Face>)
+  {
+    ++nCommands;
+  }
+
+public:
+  Ptr<TestProbeAgent> agent;
+  uint32_t nCommands;
+};
+
+BOOST_FIXTURE_TEST_SUITE(AppsProbeAgentRefresh, ProbeAgentRefreshFixture)
+
+BOOST_AUTO_TEST_CASE(RefreshPastLifetime)
+{
+  // the binding is refreshed every second, identical commands must not be answered from cache
+  addApps({
+      {"2", "ns3::ndn::ProbeProducer",
+          {{"Prefix", "/prod"}, {"HomeAgent", "true"}, {"HomeAgents", "/ha0"},
+           {"BindingLifetime", "2s"}},
+          "0.5s", "100s"}
+    });
+
+  Simulator::Stop(Seconds(10));
+  Simulator::Run();
+
+  // register at 0.5s and an update every second
+  BOOST_CHECK_GE(nCommands, 9);
+
+  const BindingTable::Binding* binding = agent->m_bindings.FindExactMatch("/prod");
+  BOOST_REQUIRE(binding != nullptr);
+  BOOST_CHECK(!binding->IsExpired(Simulator::Now()));
+  BOOST_CHECK_EQUAL(binding->locator, Name("/loc0"));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -147,6 +147,85 @@ BOOST_AUTO_TEST_CASE(CalculateRouteCase2)
   }
 }
 
+class CoalescedRouteCalculationFixture : public GlobalRoutingHelperFixture
+{
+public:
+  void
+  request()
+  {
+    GlobalRoutingHelper::RequestRouteCalculation("/prefix",
+      MakeCallback(&CoalescedRouteCalculationFixture::onCalculated, this));
+  }
+
+  void
+  onCalculated(uint32_t changes)
+  {
+    calculated.push_back(Simulator::Now());
+  }
+
+  void
+  checkRoute(bool isExpected)
+  {
+    auto ndn = Names::Find<Node>("A3")->GetObject<L3Protocol>();
+    BOOST_CHECK_EQUAL(ndn->getForwarder()->getFib().findExactMatch("/prefix") != nullptr,
+                      isExpected);
+  }
+
+public:
+  std::vector<Time> calculated;
+};
+
+BOOST_FIXTURE_TEST_CASE(CoalescedRouteCalculation, CoalescedRouteCalculationFixture)
+{
+  ofstream file1(TEST_TOPO_TXT.string().c_str());
+  file1 << "router\n\n"
+        << "#node city  y x mpi-partition\n"
+        << "A3  NA  1 1 1\n"
+        << "B3  NA  80  -40 1\n"
+        << "C3  NA  80  40  1\n\n"
+        << "link\n\n"
+        << "# from  to  capacity  metric  delay queue\n"
+        << "A3      B3  10Mbps    1 1ms 100\n"
+        << "B3      C3  10Mbps    1 1ms 100\n";
+  file1.close();
+
+  AnnotatedTopologyReader topologyReader("");
+  topologyReader.SetFileName(TEST_TOPO_TXT.string().c_str());
+  topologyReader.Read();
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.InstallAll();
+
+  ndn::GlobalRoutingHelper ndnGlobalRoutingHelper;
+  ndnGlobalRoutingHelper.InstallAll();
+  ndnGlobalRoutingHelper.AddOrigins("/prefix", Names::Find<Node>("C3"));
+
+  ndn::GlobalRoutingHelper::SetRouteCalculationHoldDown(Seconds(1));
+  ndn::GlobalRoutingHelper::SetConvergenceDelay(MilliSeconds(100));
+
+  // burst served by a single calculation at the end of hold-down plus convergence delay
+  Simulator::Schedule(Seconds(0.0), &CoalescedRouteCalculationFixture::request, this);
+  Simulator::Schedule(Seconds(0.2), &CoalescedRouteCalculationFixture::request, this);
+  Simulator::Schedule(Seconds(0.5), &CoalescedRouteCalculationFixture::request, this);
+  Simulator::Schedule(Seconds(1.0), &CoalescedRouteCalculationFixture::checkRoute, this, false);
+  Simulator::Schedule(Seconds(1.2), &CoalescedRouteCalculationFixture::checkRoute, this, true);
+
+  // next request opens a new hold-down interval
+  Simulator::Schedule(Seconds(2.0), &CoalescedRouteCalculationFixture::request, this);
+
+  Simulator::Stop(Seconds(5.0));
+  Simulator::Run();
+
+  ndn::GlobalRoutingHelper::SetRouteCalculationHoldDown(Seconds(0));
+  ndn::GlobalRoutingHelper::SetConvergenceDelay(Seconds(0));
+
+  BOOST_REQUIRE_EQUAL(calculated.size(), 4);
+  BOOST_CHECK_EQUAL(calculated[0], Seconds(1.1));
+  BOOST_CHECK_EQUAL(calculated[1], Seconds(1.1));
+  BOOST_CHECK_EQUAL(calculated[2], Seconds(1.1));
+  BOOST_CHECK_EQUAL(calculated[3], Seconds(3.1));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace ndn
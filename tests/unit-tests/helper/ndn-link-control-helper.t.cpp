@@ -22,6 +22,10 @@
 
 #include "../tests-common.hpp"
 
+#include "ns3/error-model.h"
+#include "ns3/pointer.h"
+#include "ns3/point-to-point-module.h"
+
 namespace ns3 {
 namespace ndn {
 
@@ -148,6 +152,90 @@ BOOST_AUTO_TEST_CASE(SixNodeTopology) // Bug #2783
   Simulator::Run();
 }
 
+class LinkControlHelperBatchFixture : public ScenarioHelperWithCleanupFixture
+{
+public:
+  LinkControlHelperBatchFixture()
+  {
+    createTopology({
+        {"1", "2"}, {"1", "3"},
+        {"2", "3"}, {"3", "4"},
+      });
+  }
+
+  bool
+  isFailed(const std::string& node1, const std::string& node2)
+  {
+    bool isFailed = isFailedDevice(getNetDevice(node1, node2));
+    BOOST_CHECK_EQUAL(isFailed, isFailedDevice(getNetDevice(node2, node1)));
+    return isFailed;
+  }
+
+protected:
+  bool
+  isFailedDevice(Ptr<NetDevice> device)
+  {
+    PointerValue errorModel;
+    device->GetAttribute("ReceiveErrorModel", errorModel);
+    return errorModel.Get<ErrorModel>() != nullptr && errorModel.Get<ErrorModel>()->IsEnabled();
+  }
+};
+
+BOOST_FIXTURE_TEST_CASE(BatchOperations, LinkControlHelperBatchFixture)
+{
+  LinkControlHelper::FailNodeLinks(NodeContainer(getNode("1")));
+  BOOST_CHECK(isFailed("1", "2"));
+  BOOST_CHECK(isFailed("1", "3"));
+  BOOST_CHECK(!isFailed("2", "3"));
+  BOOST_CHECK(!isFailed("3", "4"));
+
+  LinkControlHelper::UpNodeLinks(NodeContainer(getNode("1")));
+  BOOST_CHECK(!isFailed("1", "2"));
+  BOOST_CHECK(!isFailed("1", "3"));
+
+  LinkControlHelper::FailLinks({{getNode("2"), getNode("3")}, {getNode("4"), getNode("3")}});
+  BOOST_CHECK(!isFailed("1", "3"));
+  BOOST_CHECK(isFailed("2", "3"));
+  BOOST_CHECK(isFailed("3", "4"));
+
+  LinkControlHelper::UpLinks({{getNode("2"), getNode("3")}});
+  BOOST_CHECK(!isFailed("2", "3"));
+  BOOST_CHECK(isFailed("3", "4"));
+
+  LinkControlHelper::UpLink(getNode("3"), getNode("4"));
+  BOOST_CHECK(!isFailed("3", "4"));
+}
+
+BOOST_FIXTURE_TEST_CASE(ParallelLinks, LinkControlHelperBatchFixture)
+{
+  // both nodes are indexed before the parallel link is created
+  LinkControlHelper::FailNodeLinks(NodeContainer(getNode("1"), getNode("2")));
+  LinkControlHelper::UpNodeLinks(NodeContainer(getNode("1"), getNode("2")));
+  BOOST_CHECK(!isFailed("1", "2"));
+
+  // second link between nodes 1 and 2
+  PointToPointHelper p2p;
+  NetDeviceContainer parallel = p2p.Install(getNode("1"), getNode("2"));
+  StackHelper().Update(NodeContainer(getNode("1"), getNode("2")));
+
+  // the first link between the nodes is toggled by FailLink
+  LinkControlHelper::FailLink(getNode("1"), getNode("2"));
+  BOOST_CHECK(isFailed("1", "2"));
+  BOOST_CHECK(!isFailedDevice(parallel.Get(0)));
+
+  // all links of the node, including the one created after indexing, are toggled by
+  // FailNodeLinks
+  LinkControlHelper::FailNodeLinks(NodeContainer(getNode("2")));
+  BOOST_CHECK(isFailed("1", "2"));
+  BOOST_CHECK(isFailedDevice(parallel.Get(0)));
+  BOOST_CHECK(isFailedDevice(parallel.Get(1)));
+
+  LinkControlHelper::UpNodeLinks(NodeContainer(getNode("1")));
+  BOOST_CHECK(!isFailed("1", "2"));
+  BOOST_CHECK(!isFailedDevice(parallel.Get(0)));
+  BOOST_CHECK(!isFailedDevice(parallel.Get(1)));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace ndn
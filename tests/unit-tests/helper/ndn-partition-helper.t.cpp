@@ -0,0 +1,121 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "helper/ndn-partition-helper.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(HelperNdnPartitionHelper, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(SinglePartition)
+{
+  PartitionHelper helper;
+  helper.AddVertex();
+  helper.AddVertex();
+  helper.AddEdge(0, 1, MilliSeconds(10));
+
+  std::vector<uint32_t> partitions = helper.Partition(1);
+  BOOST_REQUIRE_EQUAL(partitions.size(), 2);
+  BOOST_CHECK_EQUAL(partitions[0], 0);
+  BOOST_CHECK_EQUAL(partitions[1], 0);
+  BOOST_CHECK_EQUAL(helper.GetCutTraffic(partitions), 0);
+  BOOST_CHECK(helper.GetLookahead(partitions) == Time::Max());
+}
+
+BOOST_AUTO_TEST_CASE(CutLongLink)
+{
+  // two cliques with short links, connected with a long link
+  PartitionHelper helper;
+  for (int i = 0; i < 8; ++i) {
+    helper.AddVertex();
+  }
+  for (uint32_t clique = 0; clique < 2; ++clique) {
+    for (uint32_t i = 0; i < 4; ++i) {
+      for (uint32_t j = i + 1; j < 4; ++j) {
+        helper.AddEdge(clique * 4 + i, clique * 4 + j, MilliSeconds(1));
+      }
+    }
+  }
+  helper.AddEdge(3, 4, MilliSeconds(100));
+
+  std::vector<uint32_t> partitions = helper.Partition(2);
+  BOOST_REQUIRE_EQUAL(partitions.size(), 8);
+  for (uint32_t i = 1; i < 4; ++i) {
+    BOOST_CHECK_EQUAL(partitions[i], partitions[0]);
+    BOOST_CHECK_EQUAL(partitions[4 + i], partitions[4]);
+  }
+  BOOST_CHECK_NE(partitions[0], partitions[4]);
+
+  BOOST_CHECK_EQUAL(helper.GetCutTraffic(partitions), 1);
+  BOOST_CHECK(helper.GetLookahead(partitions) == MilliSeconds(100));
+}
+
+BOOST_AUTO_TEST_CASE(BalancedGrid)
+{
+  const uint32_t SIDE = 30;
+  const uint32_t N_PARTITIONS = 7;
+
+  PartitionHelper helper;
+  for (uint32_t i = 0; i < SIDE * SIDE; ++i) {
+    helper.AddVertex();
+  }
+  for (uint32_t row = 0; row < SIDE; ++row) {
+    for (uint32_t col = 0; col < SIDE; ++col) {
+      if (col + 1 < SIDE) {
+        helper.AddEdge(row * SIDE + col, row * SIDE + col + 1, MilliSeconds(10));
+      }
+      if (row + 1 < SIDE) {
+        helper.AddEdge(row * SIDE + col, (row + 1) * SIDE + col, MilliSeconds(10));
+      }
+    }
+  }
+
+  std::vector<uint32_t> partitions = helper.Partition(N_PARTITIONS);
+  BOOST_REQUIRE_EQUAL(partitions.size(), SIDE * SIDE);
+
+  std::vector<uint32_t> sizes(N_PARTITIONS, 0);
+  for (uint32_t partition : partitions) {
+    BOOST_REQUIRE_LT(partition, N_PARTITIONS);
+    sizes[partition]++;
+  }
+  for (uint32_t size : sizes) {
+    BOOST_CHECK_GT(size, 0);
+    BOOST_CHECK_LE(size, 1.05 * SIDE * SIDE / N_PARTITIONS + 1);
+  }
+
+  // far fewer links cut than by a random assignment (~6/7 of 1740 links)
+  BOOST_CHECK_LT(helper.GetCutTraffic(partitions), 300);
+  BOOST_CHECK(helper.GetLookahead(partitions) == MilliSeconds(10));
+}
+
+BOOST_AUTO_TEST_CASE(LocalWithoutMpi)
+{
+  Ptr<Node> node = CreateObject<Node>();
+  BOOST_CHECK_EQUAL(PartitionHelper::GetNPartitions(), 1);
+  BOOST_CHECK(PartitionHelper::IsLocal(node));
+  BOOST_CHECK_EQUAL(PartitionHelper::GetLocalFileName("trace.txt"), "trace.txt");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -22,6 +22,9 @@
 
 #include "ns3/point-to-point-module.h"
 
+#include <boost/lexical_cast.hpp>
+#include <boost/property_tree/ptree.hpp>
+
 namespace ns3 {
 namespace ndn {
 
@@ -62,6 +65,108 @@ BOOST_AUTO_TEST_CASE(TestNfdContentStorePolicy)
   BOOST_CHECK_EQUAL(protoNode1->getForwarder()->getCs().getPolicy()->getName(), "priority_fifo");
 }
 
+BOOST_AUTO_TEST_CASE(BareForwarder)
+{
+  NodeContainer nodes;
+  nodes.Create(2);
+
+  PointToPointHelper p2p;
+  p2p.Install(nodes.Get(0), nodes.Get(1));
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.disableManagement();
+  ndnHelper.InstallAll();
+
+  Ptr<L3Protocol> ndn = L3Protocol::getL3Protocol(nodes.Get(0));
+  BOOST_CHECK(!ndn->isManagementEnabled());
+  BOOST_CHECK(ndn->getFibManager() == nullptr);
+  BOOST_CHECK(ndn->getStrategyChoiceManager() == nullptr);
+  BOOST_CHECK(ndn->getForwarder()->getFib().findExactMatch("/localhost/nfd") == nullptr);
+
+  // tables are still configured
+  BOOST_CHECK_EQUAL(ndn->getForwarder()->getCs().getLimit(), 100);
+
+  // helpers modify tables directly, without running the simulation
+  shared_ptr<Face> face = ndn->getFaceByNetDevice(nodes.Get(0)->GetDevice(0));
+  FibHelper::AddRoute(nodes.Get(0), "/prefix", face, 7);
+
+  auto entry = ndn->getForwarder()->getFib().findExactMatch("/prefix");
+  BOOST_REQUIRE(entry != nullptr);
+  BOOST_REQUIRE_EQUAL(entry->getNextHops().size(), 1);
+  BOOST_CHECK_EQUAL(entry->getNextHops().front().getCost(), 7);
+
+  FibHelper::RemoveRoute(nodes.Get(0), "/prefix", face);
+  BOOST_CHECK(ndn->getForwarder()->getFib().findExactMatch("/prefix") == nullptr);
+
+  StrategyChoiceHelper::Install(nodes.Get(0), "/prefix", "/localhost/nfd/strategy/multicast");
+  BOOST_CHECK(Name("/localhost/nfd/strategy/multicast")
+                .isPrefixOf(ndn->getForwarder()->getStrategyChoice()
+                              .findEffectiveStrategy("/prefix/a").getName()));
+}
+
+BOOST_AUTO_TEST_CASE(SharedConfig)
+{
+  NodeContainer nodes;
+  nodes.Create(3);
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.setCsSize(42);
+  ndnHelper.Install(nodes.Get(0));
+  ndnHelper.Install(nodes.Get(1));
+  ndnHelper.setCsSize(7);
+  ndnHelper.Install(nodes.Get(2));
+
+  Ptr<L3Protocol> ndn0 = L3Protocol::getL3Protocol(nodes.Get(0));
+  Ptr<L3Protocol> ndn1 = L3Protocol::getL3Protocol(nodes.Get(1));
+  Ptr<L3Protocol> ndn2 = L3Protocol::getL3Protocol(nodes.Get(2));
+
+  BOOST_CHECK_EQUAL(ndn0->getForwarder()->getCs().getLimit(), 42);
+  BOOST_CHECK_EQUAL(ndn1->getForwarder()->getCs().getLimit(), 42);
+  BOOST_CHECK_EQUAL(ndn2->getForwarder()->getCs().getLimit(), 7);
+  BOOST_CHECK(Name("/localhost/nfd/strategy/multicast")
+                .isPrefixOf(ndn1->getForwarder()->getStrategyChoice()
+                              .findEffectiveStrategy("/localhost/a").getName()));
+
+  // modification of the config is not visible to nodes sharing it
+  ndn0->getConfig().put("tables.cs_max_packets", 1);
+  BOOST_CHECK_EQUAL(ndn0->getConfig().get<size_t>("tables.cs_max_packets"), 1);
+  BOOST_CHECK_EQUAL(ndn1->getConfig().get<size_t>("tables.cs_max_packets"), 42);
+  BOOST_CHECK_EQUAL(L3Protocol::getDefaultConfig()->get<size_t>("tables.cs_max_packets"), 100);
+}
+
+BOOST_AUTO_TEST_CASE(BulkInstall)
+{
+  // enough devices to prepare face URIs in several worker threads
+  const uint32_t N_LINKS = 1100;
+
+  NodeContainer nodes;
+  nodes.Create(2 * N_LINKS);
+
+  PointToPointHelper p2p;
+  for (uint32_t i = 0; i < N_LINKS; ++i) {
+    p2p.Install(nodes.Get(2 * i), nodes.Get(2 * i + 1));
+  }
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.disableManagement();
+  ndnHelper.setInstallThreads(2);
+  Ptr<FaceContainer> faces = ndnHelper.Install(nodes);
+
+  BOOST_REQUIRE_EQUAL(faces->GetN(), 2 * N_LINKS);
+  for (uint32_t i = 0; i < 2 * N_LINKS; i += 2) {
+    shared_ptr<Face> face = faces->Get(i);
+    shared_ptr<Face> peerFace = faces->Get(i + 1);
+
+    Ptr<NetDevice> device = nodes.Get(i)->GetDevice(0);
+    std::string uri = "netdev://[" +
+      boost::lexical_cast<std::string>(Mac48Address::ConvertFrom(device->GetAddress())) + "]";
+
+    BOOST_CHECK_EQUAL(face->getLocalUri().toString(), uri);
+    BOOST_CHECK_EQUAL(face->getRemoteUri(), peerFace->getLocalUri());
+    BOOST_CHECK_EQUAL(peerFace->getRemoteUri(), face->getLocalUri());
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace ndn
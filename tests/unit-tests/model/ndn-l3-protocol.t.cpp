@@ -19,6 +19,9 @@
 
 #include "helper/ndn-scenario-helper.hpp"
 #include "helper/ndn-app-helper.hpp"
+#include "model/ndn-net-device-transport.hpp"
+
+#include "ns3/point-to-point-module.h"
 
 #include <ndn-cxx/face.hpp>
 
@@ -29,6 +32,29 @@ namespace ndn {
 
 BOOST_FIXTURE_TEST_SUITE(ModelNdnL3Protocol, ScenarioHelperWithCleanupFixture)
 
+BOOST_AUTO_TEST_CASE(FaceByNetDevice)
+{
+  createTopology({
+      {"1", "2"},
+      {"1", "3"},
+    });
+
+  Ptr<L3Protocol> ndn = getNode("1")->GetObject<L3Protocol>();
+  for (const std::string& other : {"2", "3"}) {
+    shared_ptr<Face> face = ndn->getFaceByNetDevice(getNetDevice("1", other));
+    BOOST_REQUIRE(face != nullptr);
+
+    auto transport = dynamic_cast<NetDeviceTransport*>(face->getTransport());
+    BOOST_REQUIRE(transport != nullptr);
+    BOOST_CHECK(transport->GetNetDevice() == getNetDevice("1", other));
+  }
+
+  // device installed after the stack has no face
+  PointToPointHelper p2p;
+  NetDeviceContainer devices = p2p.Install(getNode("2"), getNode("3"));
+  BOOST_CHECK(getNode("2")->GetObject<L3Protocol>()->getFaceByNetDevice(devices.Get(0)) == nullptr);
+}
+
 class TesterApp
 {
 public:
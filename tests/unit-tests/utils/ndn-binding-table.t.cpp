@@ -0,0 +1,119 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/ndn-binding-table.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_AUTO_TEST_SUITE(UtilsNdnBindingTable)
+
+BOOST_AUTO_TEST_CASE(InsertUpdateErase)
+{
+  BindingTable table;
+
+  auto result = table.Insert("/prod1", "/loc1");
+  BOOST_CHECK(result.second);
+  BOOST_CHECK_EQUAL(result.first->locator, Name("/loc1"));
+
+  result = table.Insert("/prod1", "/loc2");
+  BOOST_CHECK(!result.second);
+  BOOST_CHECK_EQUAL(result.first->locator, Name("/loc2"));
+  BOOST_CHECK_EQUAL(table.GetSize(), 1);
+
+  BOOST_REQUIRE(table.FindExactMatch("/prod1") != nullptr);
+  BOOST_CHECK_EQUAL(table.FindExactMatch("/prod1")->locator, Name("/loc2"));
+  BOOST_CHECK(table.FindExactMatch("/prod2") == nullptr);
+  BOOST_CHECK(table.FindExactMatch("/prod1/object") == nullptr);
+
+  BOOST_CHECK(!table.Erase("/prod2"));
+  BOOST_CHECK(table.Erase("/prod1"));
+  BOOST_CHECK_EQUAL(table.GetSize(), 0);
+  BOOST_CHECK(table.FindLongestPrefixMatch("/prod1/object") == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(LongestPrefixMatch)
+{
+  BindingTable table;
+  table.Insert("/prod", "/loc1");
+  table.Insert("/prod/video", "/loc2");
+  table.Insert("/prod/video/hd/segments", "/loc3");
+
+  BOOST_CHECK(table.FindLongestPrefixMatch("/") == nullptr);
+  BOOST_CHECK(table.FindLongestPrefixMatch("/other/object") == nullptr);
+  BOOST_CHECK_EQUAL(table.FindLongestPrefixMatch("/prod")->locator, Name("/loc1"));
+  BOOST_CHECK_EQUAL(table.FindLongestPrefixMatch("/prod/audio/1")->locator, Name("/loc1"));
+  BOOST_CHECK_EQUAL(table.FindLongestPrefixMatch("/prod/video/1")->locator, Name("/loc2"));
+  BOOST_CHECK_EQUAL(table.FindLongestPrefixMatch("/prod/video/hd/1")->locator, Name("/loc2"));
+  BOOST_CHECK_EQUAL(table.FindLongestPrefixMatch("/prod/video/hd/segments/%00%01")->locator,
+                    Name("/loc3"));
+
+  table.Insert("/", "/default");
+  BOOST_CHECK_EQUAL(table.FindLongestPrefixMatch("/other/object")->locator, Name("/default"));
+
+  table.Erase("/prod/video");
+  BOOST_CHECK_EQUAL(table.FindLongestPrefixMatch("/prod/video/1")->locator, Name("/loc1"));
+}
+
+BOOST_AUTO_TEST_CASE(Expiry)
+{
+  BindingTable table;
+  table.Insert("/prod1", "/loc1", Seconds(10));
+  table.Insert("/prod2", "/loc2", Seconds(20));
+  table.Insert("/prod3", "/loc3"); // does not expire
+
+  BOOST_CHECK(!table.FindLongestPrefixMatch("/prod1/object")->IsExpired(Seconds(5)));
+  BOOST_CHECK(table.FindLongestPrefixMatch("/prod1/object")->IsExpired(Seconds(10)));
+
+  BOOST_CHECK_EQUAL(table.EraseExpired(Seconds(5)), 0);
+  BOOST_CHECK_EQUAL(table.EraseExpired(Seconds(15)), 1);
+  BOOST_CHECK(table.FindLongestPrefixMatch("/prod1/object") == nullptr);
+
+  // refresh
+  table.Insert("/prod2", "/loc4", Seconds(30));
+  BOOST_CHECK_EQUAL(table.EraseExpired(Seconds(25)), 0);
+  BOOST_CHECK_EQUAL(table.FindLongestPrefixMatch("/prod2/object")->locator, Name("/loc4"));
+
+  BOOST_CHECK_EQUAL(table.EraseExpired(Seconds(1000)), 1);
+  BOOST_CHECK_EQUAL(table.GetSize(), 1);
+  BOOST_CHECK(table.FindExactMatch("/prod3") != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(ManyBindings)
+{
+  BindingTable table;
+  for (int i = 0; i < 10000; ++i) {
+    table.Insert(Name("/prod" + std::to_string(i)), Name("/loc" + std::to_string(i % 100)));
+  }
+  BOOST_CHECK_EQUAL(table.GetSize(), 10000);
+
+  for (int i = 0; i < 10000; ++i) {
+    const BindingTable::Binding* binding =
+      table.FindLongestPrefixMatch(Name("/prod" + std::to_string(i)).appendSequenceNumber(i));
+    BOOST_REQUIRE(binding != nullptr);
+    BOOST_CHECK_EQUAL(binding->locator, Name("/loc" + std::to_string(i % 100)));
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
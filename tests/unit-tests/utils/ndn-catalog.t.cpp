@@ -0,0 +1,96 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/ndn-catalog.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class CatalogFixture : public CleanupFixture
+{
+public:
+  CatalogFixture()
+    : catalog(CreateObject<Catalog>())
+  {
+    catalog->setUserPopulationSize(100);
+    catalog->setPopularity(1.0, 10);
+    catalog->setObjectPopularityVariation(0.0);
+    catalog->setObjectSize(1000, 0.0);
+    catalog->initializeCatalog();
+  }
+
+public:
+  Ptr<Catalog> catalog;
+};
+
+BOOST_FIXTURE_TEST_SUITE(UtilsNdnCatalog, CatalogFixture)
+
+BOOST_AUTO_TEST_CASE(UserPopularity)
+{
+  // each rank is given out exactly once; the most popular user gets maxRequests / population
+  std::vector<double> popularities;
+  for (int i = 0; i < 100; ++i) {
+    popularities.push_back(catalog->getUserPopularity());
+  }
+  std::sort(popularities.begin(), popularities.end());
+
+  BOOST_CHECK_CLOSE(popularities.back(), 10.0 / 100, 0.0001);
+  BOOST_CHECK_CLOSE(popularities.front(), 10.0 / 100 / 100, 0.0001);
+  BOOST_CHECK(std::adjacent_find(popularities.begin(), popularities.end()) == popularities.end());
+}
+
+BOOST_AUTO_TEST_CASE(ObjectsById)
+{
+  catalog->reserveObjects(10);
+  catalog->addObject(3, 0.5);
+
+  BOOST_CHECK(catalog->hasObject(3));
+  BOOST_CHECK(!catalog->hasObject(2));
+  BOOST_CHECK(!catalog->hasObject(100));
+  BOOST_CHECK_CLOSE(catalog->getObjectProperties(3).popularity, 0.5, 0.0001);
+  BOOST_CHECK_EQUAL(catalog->getObjectProperties(3).size, 1000);
+  BOOST_CHECK_EQUAL(catalog->getObjectProperties(100).size, 0);
+
+  catalog->removeObject(3);
+  BOOST_CHECK(!catalog->hasObject(3));
+  BOOST_CHECK_EQUAL(catalog->getObjectProperties(3).size, 0);
+}
+
+BOOST_AUTO_TEST_CASE(ObjectsByName)
+{
+  catalog->addObject(5, 0.1);
+  catalog->addObject(Name("/object/1"), 0.25);
+  catalog->addObject(Name("/object/2"), 0.75);
+
+  BOOST_CHECK_CLOSE(catalog->getObjectProperties(Name("/object/1")).popularity, 0.25, 0.0001);
+  BOOST_CHECK_CLOSE(catalog->getObjectProperties(Name("/object/2")).popularity, 0.75, 0.0001);
+  BOOST_CHECK_CLOSE(catalog->getObjectProperties(5).popularity, 0.1, 0.0001);
+  BOOST_CHECK_EQUAL(catalog->getObjectProperties(Name("/object/3")).size, 0);
+
+  catalog->removeObject(Name("/object/1"));
+  BOOST_CHECK_EQUAL(catalog->getObjectProperties(Name("/object/1")).size, 0);
+  BOOST_CHECK_EQUAL(catalog->getObjectProperties(Name("/object/2")).size, 1000);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
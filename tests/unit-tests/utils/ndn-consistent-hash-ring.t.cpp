@@ -0,0 +1,86 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/ndn-consistent-hash-ring.hpp"
+
+#include "../tests-common.hpp"
+
+#include <map>
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_AUTO_TEST_SUITE(UtilsNdnConsistentHashRing)
+
+BOOST_AUTO_TEST_CASE(Balance)
+{
+  ConsistentHashRing ring;
+  for (int i = 0; i < 4; ++i) {
+    ring.AddReplica(Name("/ha" + std::to_string(i)));
+  }
+  BOOST_CHECK_EQUAL(ring.GetNReplicas(), 4);
+
+  std::map<Name, int> counts;
+  for (int i = 0; i < 10000; ++i) {
+    ++counts[ring.GetReplica(Name("/prod" + std::to_string(i)))];
+  }
+
+  BOOST_CHECK_EQUAL(counts.size(), 4);
+  for (const auto& count : counts) {
+    BOOST_CHECK_GT(count.second, 1500);
+    BOOST_CHECK_LT(count.second, 3500);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(MinimalReassignment)
+{
+  ConsistentHashRing ring;
+  ConsistentHashRing reversed;
+  for (int i = 0; i < 4; ++i) {
+    ring.AddReplica(Name("/ha" + std::to_string(i)));
+    reversed.AddReplica(Name("/ha" + std::to_string(3 - i)));
+  }
+
+  std::vector<Name> before;
+  for (int i = 0; i < 1000; ++i) {
+    before.push_back(ring.GetReplica(Name("/prod" + std::to_string(i))));
+    // independent of the order of replicas
+    BOOST_CHECK_EQUAL(before.back(), reversed.GetReplica(Name("/prod" + std::to_string(i))));
+  }
+
+  ring.AddReplica("/ha4");
+  BOOST_CHECK_EQUAL(ring.GetNReplicas(), 5);
+  for (int i = 0; i < 1000; ++i) {
+    const Name& after = ring.GetReplica(Name("/prod" + std::to_string(i)));
+    if (after != before[i]) {
+      BOOST_CHECK_EQUAL(after, Name("/ha4")); // only moved to the new replica
+    }
+  }
+
+  ring.RemoveReplica("/ha4");
+  BOOST_CHECK_EQUAL(ring.GetNReplicas(), 4);
+  for (int i = 0; i < 1000; ++i) {
+    BOOST_CHECK_EQUAL(ring.GetReplica(Name("/prod" + std::to_string(i))), before[i]);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
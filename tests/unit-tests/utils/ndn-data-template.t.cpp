@@ -0,0 +1,69 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/ndn-data-template.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_AUTO_TEST_SUITE(UtilsNdnDataTemplate)
+
+BOOST_AUTO_TEST_CASE(MatchesFullEncoding)
+{
+  DataTemplate dataTemplate;
+  BOOST_CHECK(!dataTemplate.IsSet());
+
+  dataTemplate.Set(*DataTemplate::MakeVirtualData(1024, Seconds(1), 42, "/key/locator"));
+  BOOST_CHECK(dataTemplate.IsSet());
+
+  std::vector<Name> names = {"/", "/prefix/%FE%01", "/a/much/longer/name/with/many/components"};
+  for (const Name& name : names) {
+    shared_ptr<Data> expected = DataTemplate::MakeVirtualData(1024, Seconds(1), 42,
+                                                              "/key/locator");
+    expected->setName(name);
+    const Block& expectedWire = expected->wireEncode();
+
+    shared_ptr<Data> data = dataTemplate.Instantiate(name);
+    BOOST_CHECK_EQUAL(data->getName(), name);
+    BOOST_CHECK_EQUAL(data->getContent().value_size(), 1024);
+    BOOST_CHECK_EQUAL(data->getFreshnessPeriod(), time::seconds(1));
+    BOOST_CHECK_EQUAL_COLLECTIONS(data->wireEncode().begin(), data->wireEncode().end(),
+                                  expectedWire.begin(), expectedWire.end());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ProducerLocation)
+{
+  shared_ptr<Data> data = DataTemplate::MakeVirtualData(100, Seconds(0), 0, Name());
+  ProdLocInfo prodloc;
+  prodloc.setLocation(7);
+  data->setProdLocInfo(prodloc);
+
+  DataTemplate dataTemplate;
+  dataTemplate.Set(*data);
+
+  BOOST_CHECK_EQUAL(dataTemplate.Instantiate("/prod/object")->getProdLocInfo().getLocation(), 7);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,132 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/ndn-memory-usage.hpp"
+#include "utils/tracers/ndn-memory-tracer.hpp"
+#include "model/cs/ndn-content-store.hpp"
+
+#include <boost/filesystem.hpp>
+#include <fstream>
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+const boost::filesystem::path TEST_TRACE = boost::filesystem::path(TEST_CONFIG_PATH) / "memory-trace.txt";
+
+class MemoryUsageFixture : public ScenarioHelperWithCleanupFixture
+{
+public:
+  MemoryUsageFixture()
+  {
+    boost::filesystem::create_directories(TEST_CONFIG_PATH);
+
+    Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("10Mbps"));
+    Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("10ms"));
+    Config::SetDefault("ns3::DropTailQueue::MaxPackets", StringValue("20"));
+
+    getStackHelper().SetOldContentStore("ns3::ndn::cs::Lru", "MaxSize", "100");
+
+    createTopology({
+        {"1", "2"}
+      });
+
+    addRoutes({
+        {"1", "2", "/prefix", 1}
+      });
+
+    addApps({
+        {"1", "ns3::ndn::ConsumerCbr",
+            {{"Prefix", "/prefix"}, {"Frequency", "10"}},
+            "0s", "1s"},
+        {"2", "ns3::ndn::Producer",
+            {{"Prefix", "/prefix"}, {"PayloadSize", "1024"}},
+            "0s", "100s"}
+      });
+  }
+
+  ~MemoryUsageFixture()
+  {
+    boost::filesystem::remove(TEST_TRACE);
+    MemoryTracer::Destroy();
+  }
+};
+
+BOOST_FIXTURE_TEST_SUITE(UtilsNdnMemoryUsage, MemoryUsageFixture)
+
+BOOST_AUTO_TEST_CASE(ContentStore)
+{
+  Simulator::Stop(Seconds(2));
+  Simulator::Run();
+
+  Ptr<ContentStore> cs = getNode("1")->GetObject<ContentStore>();
+  TableMemoryUsage usage = cs->GetMemoryUsage();
+
+  BOOST_CHECK_EQUAL(usage.m_csEntries, cs->GetSize());
+  BOOST_CHECK_GT(usage.m_csEntries, 0);
+  BOOST_CHECK_GT(usage.m_csData, usage.m_csEntries * 1024);
+  BOOST_CHECK_GT(usage.m_csTrie, 0);
+  BOOST_CHECK_GT(usage.m_csPolicy, 0);
+}
+
+BOOST_AUTO_TEST_CASE(Node)
+{
+  Simulator::Stop(Seconds(2));
+  Simulator::Run();
+
+  TableMemoryUsage usage = TableMemoryUsage::Get(getNode("1"));
+  BOOST_CHECK_EQUAL(usage.m_csEntries, getNode("1")->GetObject<ContentStore>()->GetSize());
+  BOOST_CHECK_GE(usage.m_fibEntries, 1);
+  BOOST_CHECK_GT(usage.m_fib, 0);
+  BOOST_CHECK_GT(usage.m_nameTree, 0);
+  BOOST_CHECK_EQUAL(usage.GetTotal(), usage.m_csTrie + usage.m_csPolicy + usage.m_csData
+                                        + usage.m_pit + usage.m_fib + usage.m_nameTree);
+
+  TableMemoryUsage total = usage;
+  total += TableMemoryUsage::Get(getNode("2"));
+  BOOST_CHECK_GE(total.GetTotal(), usage.GetTotal());
+}
+
+BOOST_AUTO_TEST_CASE(Tracer)
+{
+  MemoryTracer::InstallAll(TEST_TRACE.string(), Seconds(1), true);
+
+  Simulator::Stop(Seconds(2.5));
+  Simulator::Run();
+
+  MemoryTracer::Destroy();
+
+  std::ifstream is(TEST_TRACE.string().c_str());
+  std::string line;
+  std::getline(is, line);
+  BOOST_CHECK_EQUAL(line, "Time\tNode\tType\tEntries\tBytes");
+
+  size_t nLines = 0;
+  while (std::getline(is, line)) {
+    nLines++;
+  }
+  // 2 periods x ((2 nodes + all) x 7 types + Rss)
+  BOOST_CHECK_EQUAL(nLines, 2 * (3 * 7 + 1));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,181 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/ndn-profiler.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+const boost::filesystem::path TEST_PROFILE = boost::filesystem::path(TEST_CONFIG_PATH) / "profile.txt";
+
+class ProfilerFixture : public ScenarioHelperWithCleanupFixture
+{
+public:
+  ProfilerFixture()
+  {
+    boost::filesystem::create_directories(TEST_CONFIG_PATH);
+
+    Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("10Mbps"));
+    Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("10ms"));
+    Config::SetDefault("ns3::DropTailQueue::MaxPackets", StringValue("20"));
+  }
+
+  ~ProfilerFixture()
+  {
+    boost::filesystem::remove(TEST_PROFILE);
+    Profiler::Destroy();
+  }
+
+  void
+  setup()
+  {
+    createTopology({
+        {"1", "2"}
+      });
+
+    addRoutes({
+        {"1", "2", "/prefix", 1}
+      });
+
+    addApps({
+        {"1", "ns3::ndn::ConsumerCbr",
+            {{"Prefix", "/prefix"}, {"Frequency", "10"}},
+            "0s", "1s"},
+        {"2", "ns3::ndn::Producer",
+            {{"Prefix", "/prefix"}, {"PayloadSize", "1024"}},
+            "0s", "100s"}
+      });
+  }
+
+  /**
+   * @return report lines of the stage
+   */
+  std::vector<std::string>
+  readStage(const std::string& stage)
+  {
+    std::ifstream is(TEST_PROFILE.string().c_str());
+    std::vector<std::string> lines;
+    std::string line;
+    while (std::getline(is, line)) {
+      if (line.find("\t" + stage + "\t") != std::string::npos) {
+        lines.push_back(line);
+      }
+    }
+    return lines;
+  }
+};
+
+BOOST_FIXTURE_TEST_SUITE(UtilsNdnProfiler, ProfilerFixture)
+
+BOOST_AUTO_TEST_CASE(Disabled)
+{
+  setup();
+  Simulator::Stop(Seconds(2));
+  Simulator::Run();
+
+  BOOST_CHECK_EQUAL(Profiler::IsEnabled(), false);
+  BOOST_CHECK_EQUAL(Profiler::GetCount(Profiler::NETDEVICE_SEND), 0);
+  BOOST_CHECK_EQUAL(Profiler::GetCount(Profiler::NETDEVICE_RECEIVE), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Install)
+{
+  setup();
+  Profiler::Install(TEST_PROFILE.string(), Seconds(1.5));
+
+  Simulator::Stop(Seconds(2));
+  Simulator::Run();
+
+  if (Profiler::IsCompiledIn()) {
+    BOOST_CHECK_GT(Profiler::GetCount(Profiler::NETDEVICE_SEND), 0);
+    BOOST_CHECK_GT(Profiler::GetCount(Profiler::NETDEVICE_RECEIVE), 0);
+    BOOST_CHECK_GT(Profiler::GetCount(Profiler::BLOCK_HEADER_DESERIALIZE), 0);
+    BOOST_CHECK_GT(Profiler::GetCount(Profiler::APP_LINK_DISPATCH), 0);
+  }
+  else {
+    BOOST_CHECK_EQUAL(Profiler::GetCount(Profiler::NETDEVICE_SEND), 0);
+  }
+
+  Profiler::Destroy(); // to force log to be written
+
+  std::ifstream is(TEST_PROFILE.string().c_str());
+  std::string line;
+  std::getline(is, line);
+  BOOST_CHECK_EQUAL(line, "Time	RealTime	Stage	Count	EventsPerSec	NsPerPacket	RssMiB");
+
+  size_t nLines = 0;
+  while (std::getline(is, line)) {
+    ++nLines;
+  }
+  BOOST_CHECK_EQUAL(nLines, static_cast<size_t>(Profiler::STAGE_COUNT)); // single report
+
+  // NFD's content store is not instrumented
+  BOOST_CHECK(!Profiler::IsStageAvailable(Profiler::CS_LOOKUP));
+  std::vector<std::string> lines = readStage("CsLookup");
+  BOOST_REQUIRE_EQUAL(lines.size(), 1);
+  BOOST_CHECK(lines[0].find("\tn/a\tn/a\tn/a\t") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(OldContentStore)
+{
+  getStackHelper().SetOldContentStore("ns3::ndn::cs::Lru", "MaxSize", "100");
+  setup();
+  Profiler::Install(TEST_PROFILE.string(), Seconds(1.5));
+
+  Simulator::Stop(Seconds(2));
+  Simulator::Run();
+
+  BOOST_CHECK(Profiler::IsStageAvailable(Profiler::CS_LOOKUP));
+  if (Profiler::IsCompiledIn()) {
+    BOOST_CHECK_GT(Profiler::GetCount(Profiler::CS_LOOKUP), 0);
+    BOOST_CHECK_GT(Profiler::GetCount(Profiler::CS_INSERT), 0);
+  }
+
+  Profiler::Destroy(); // to force log to be written
+
+  std::vector<std::string> lines = readStage("CsLookup");
+  BOOST_REQUIRE_EQUAL(lines.size(), 1);
+  BOOST_CHECK(lines[0].find("n/a") == std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(GlobalValue)
+{
+  setup();
+
+  Config::SetGlobal("NdnProfile", StringValue(TEST_PROFILE.string() + ":1.5"));
+  Profiler::InstallFromEnvironment();
+  Config::SetGlobal("NdnProfile", StringValue(""));
+
+  BOOST_CHECK_EQUAL(Profiler::IsEnabled(), true);
+
+  Simulator::Stop(Seconds(2));
+  Simulator::Run();
+
+  Profiler::Destroy(); // to force log to be written
+  BOOST_CHECK_EQUAL(readStage("NetDeviceSend").size(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,91 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/ndn-seq-state-table.hpp"
+
+#include <map>
+#include <random>
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_AUTO_TEST_SUITE(UtilsNdnSeqStateTable)
+
+BOOST_AUTO_TEST_CASE(Basic)
+{
+  SeqStateTable table;
+  BOOST_CHECK_EQUAL(table.GetSize(), 0);
+  BOOST_CHECK(table.Find(1) == nullptr);
+
+  SeqState& state = table.Insert(1);
+  BOOST_CHECK_EQUAL(state.retxCount, 0);
+  BOOST_CHECK_EQUAL(state.pendingTimeout, false);
+  state.retxCount = 5;
+
+  BOOST_REQUIRE(table.Find(1) != nullptr);
+  BOOST_CHECK_EQUAL(table.Find(1)->retxCount, 5);
+  BOOST_CHECK_EQUAL(table.Insert(1).retxCount, 5);
+  BOOST_CHECK_EQUAL(table.GetSize(), 1);
+
+  table.Erase(2); // no such entry
+  table.Erase(1);
+  BOOST_CHECK(table.Find(1) == nullptr);
+  BOOST_CHECK_EQUAL(table.GetSize(), 0);
+  BOOST_CHECK_EQUAL(table.Insert(1).retxCount, 0);
+}
+
+BOOST_AUTO_TEST_CASE(MatchesMap)
+{
+  SeqStateTable table;
+  std::map<uint32_t, uint32_t> reference;
+
+  std::mt19937 rng(1);
+  for (int i = 0; i < 100000; ++i) {
+    // mix of a sliding window of sequence numbers and random ones (as ConsumerZipfMandelbrot)
+    uint32_t seq = (rng() % 2 == 0) ? i / 2 + rng() % 64 : rng() % 5000;
+    switch (rng() % 3) {
+    case 0:
+    case 1:
+      table.Insert(seq).retxCount++;
+      reference[seq]++;
+      break;
+    case 2:
+      table.Erase(seq);
+      reference.erase(seq);
+      break;
+    }
+  }
+
+  BOOST_CHECK_EQUAL(table.GetSize(), reference.size());
+  for (const auto& entry : reference) {
+    SeqState* state = table.Find(entry.first);
+    BOOST_REQUIRE(state != nullptr);
+    BOOST_CHECK_EQUAL(state->retxCount, entry.second);
+  }
+  for (uint32_t seq = 0; seq < 60000; ++seq) {
+    BOOST_REQUIRE_EQUAL(table.Find(seq) != nullptr, reference.count(seq) > 0);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
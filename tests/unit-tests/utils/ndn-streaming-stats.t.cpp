@@ -0,0 +1,103 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/ndn-streaming-stats.hpp"
+
+#include <cmath>
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_AUTO_TEST_SUITE(UtilsNdnStreamingStats)
+
+BOOST_AUTO_TEST_CASE(Empty)
+{
+  StreamingStats stats;
+  BOOST_CHECK_EQUAL(stats.GetCount(), 0);
+  BOOST_CHECK_EQUAL(stats.GetVariance(), 0);
+  BOOST_CHECK(std::isnan(stats.GetQuantile(0.5)));
+}
+
+BOOST_AUTO_TEST_CASE(MeanVariance)
+{
+  StreamingStats stats;
+  for (double value : {2.0, 4.0, 4.0, 4.0, 5.0, 5.0, 7.0, 9.0}) {
+    stats.Add(value);
+  }
+
+  BOOST_CHECK_EQUAL(stats.GetCount(), 8);
+  BOOST_CHECK_CLOSE(stats.GetMean(), 5.0, 0.0001);
+  BOOST_CHECK_CLOSE(stats.GetVariance(), 32.0 / 7, 0.0001);
+  BOOST_CHECK_EQUAL(stats.GetMin(), 2.0);
+  BOOST_CHECK_EQUAL(stats.GetMax(), 9.0);
+
+  stats.Reset();
+  BOOST_CHECK_EQUAL(stats.GetCount(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Quantiles)
+{
+  StreamingStats stats(0.01);
+  for (int value = 1; value <= 1000; ++value) {
+    stats.Add(value);
+  }
+
+  BOOST_CHECK_CLOSE(stats.GetQuantile(0.5), 500, 1.5);
+  BOOST_CHECK_CLOSE(stats.GetQuantile(0.9), 900, 1.5);
+  BOOST_CHECK_CLOSE(stats.GetQuantile(0.99), 990, 1.5);
+  BOOST_CHECK_EQUAL(stats.GetQuantile(0), 1);
+  BOOST_CHECK_EQUAL(stats.GetQuantile(1), 1000);
+}
+
+BOOST_AUTO_TEST_CASE(NegativeAndZero)
+{
+  StreamingStats stats;
+  for (int value = -5; value <= 5; ++value) {
+    stats.Add(value);
+  }
+
+  BOOST_CHECK_CLOSE(stats.GetQuantile(0), -5, 1.5);
+  BOOST_CHECK_EQUAL(stats.GetQuantile(0.5), 0);
+  BOOST_CHECK_CLOSE(stats.GetQuantile(0.1), -4, 1.5);
+  BOOST_CHECK_CLOSE(stats.GetQuantile(0.9), 4, 1.5);
+}
+
+BOOST_AUTO_TEST_CASE(Merge)
+{
+  StreamingStats all;
+  StreamingStats first;
+  StreamingStats second;
+  for (int value = 0; value < 100; ++value) {
+    all.Add(value);
+    (value % 3 == 0 ? first : second).Add(value);
+  }
+
+  first.Merge(second);
+  BOOST_CHECK_EQUAL(first.GetCount(), all.GetCount());
+  BOOST_CHECK_CLOSE(first.GetMean(), all.GetMean(), 0.0001);
+  BOOST_CHECK_CLOSE(first.GetVariance(), all.GetVariance(), 0.0001);
+  BOOST_CHECK_EQUAL(first.GetQuantile(0.5), all.GetQuantile(0.5));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
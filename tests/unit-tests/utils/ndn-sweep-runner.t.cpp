@@ -0,0 +1,137 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/ndn-sweep-runner.hpp"
+#include "utils/tracers/ndn-app-delay-tracer.hpp"
+
+#include <boost/filesystem.hpp>
+#include <fstream>
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+const boost::filesystem::path TEST_RESULT = boost::filesystem::path(TEST_CONFIG_PATH) / "sweep.txt";
+
+class SweepRunnerFixture : public ScenarioHelperWithCleanupFixture
+{
+public:
+  SweepRunnerFixture()
+  {
+    boost::filesystem::create_directories(TEST_CONFIG_PATH);
+
+    Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("10Mbps"));
+    Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("10ms"));
+    Config::SetDefault("ns3::DropTailQueue::MaxPackets", StringValue("20"));
+
+    createTopology({
+        {"1", "2"}
+      });
+
+    addRoutes({
+        {"1", "2", "/prefix", 1}
+      });
+
+    addApps({
+        {"2", "ns3::ndn::Producer",
+            {{"Prefix", "/prefix"}, {"PayloadSize", "1024"}},
+            "0s", "100s"}
+      });
+
+    Simulator::Stop(Seconds(2));
+  }
+
+  ~SweepRunnerFixture()
+  {
+    boost::filesystem::remove(TEST_RESULT);
+  }
+
+  void
+  installConsumer(const SweepRunner::Point& point, const std::string& output)
+  {
+    addApps({
+        {"1", "ns3::ndn::ConsumerCbr",
+            {{"Prefix", "/prefix"}, {"Frequency", point.at("freq")}},
+            "0s", "1s"}
+      });
+
+    AppDelayTracer::InstallAll(output);
+  }
+};
+
+BOOST_FIXTURE_TEST_SUITE(UtilsNdnSweepRunner, SweepRunnerFixture)
+
+BOOST_AUTO_TEST_CASE(Points)
+{
+  SweepRunner sweep;
+  sweep.AddDimension("cs", {"10", "100"});
+  sweep.AddDimension("req", {"1", "2", "5"});
+  sweep.AddPoint({{"cs", "0"}, {"req", "0"}});
+
+  BOOST_REQUIRE_EQUAL(sweep.GetPoints().size(), 7);
+  BOOST_CHECK_EQUAL(SweepRunner::GetPointName(sweep.GetPoints()[0]), "cs=10-req=1");
+  BOOST_CHECK_EQUAL(SweepRunner::GetPointName(sweep.GetPoints()[5]), "cs=100-req=5");
+  BOOST_CHECK_EQUAL(SweepRunner::GetPointName(sweep.GetPoints()[6]), "cs=0-req=0");
+}
+
+BOOST_AUTO_TEST_CASE(MergedResult)
+{
+  SweepRunner sweep;
+  sweep.AddDimension("freq", {"1", "10"});
+  sweep.SetMaxProcesses(2);
+
+  using namespace std::placeholders;
+  uint32_t nFailed = sweep.Run(std::bind(&SweepRunnerFixture::installConsumer, this, _1, _2),
+                               TEST_RESULT.string());
+  BOOST_CHECK_EQUAL(nFailed, 0);
+
+  // template simulation is not affected by the runs
+  BOOST_CHECK_EQUAL(getNode("1")->GetNApplications(), 0);
+
+  std::ifstream is(TEST_RESULT.string().c_str());
+  BOOST_REQUIRE(is.is_open());
+
+  std::string line;
+  BOOST_REQUIRE(std::getline(is, line));
+  BOOST_CHECK_EQUAL(line.substr(0, 10), "freq\tTime\t");
+
+  size_t nLines[2] = {0, 0};
+  while (std::getline(is, line)) {
+    if (line.compare(0, 2, "1\t") == 0) {
+      nLines[0]++;
+    }
+    else if (line.compare(0, 3, "10\t") == 0) {
+      nLines[1]++;
+    }
+    else {
+      BOOST_ERROR("Unexpected line: " << line);
+    }
+  }
+  BOOST_CHECK_GT(nLines[0], 0);
+  BOOST_CHECK_GT(nLines[1], nLines[0]);
+
+  BOOST_CHECK(!boost::filesystem::exists(TEST_RESULT.string() + ".run-0"));
+  BOOST_CHECK(!boost::filesystem::exists(TEST_RESULT.string() + ".run-1"));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,91 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/ndn-zipf-table.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_AUTO_TEST_SUITE(UtilsNdnZipfTable)
+
+BOOST_AUTO_TEST_CASE(BinarySearchMatchesLinearScan)
+{
+  ZipfTable table(1000, 0.7, 0.7, ZipfTable::BINARY_SEARCH);
+
+  // reference implementation (the former ConsumerZipfMandelbrot::GetNextSeq)
+  std::vector<double> cdf(1001);
+  for (uint32_t i = 1; i <= 1000; i++) {
+    cdf[i] = cdf[i - 1] + 1.0 / std::pow(i + 0.7, 0.7);
+  }
+  for (uint32_t i = 1; i <= 1000; i++) {
+    cdf[i] = cdf[i] / cdf[1000];
+  }
+
+  for (uint32_t step = 1; step <= 100000; ++step) {
+    double u = step / 100000.0;
+    uint32_t expected = 1;
+    for (uint32_t i = 1; i <= 1000; i++) {
+      if (u <= cdf[i]) {
+        expected = i;
+        break;
+      }
+    }
+    BOOST_REQUIRE_EQUAL(table.Sample(u), expected);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(AliasDistribution)
+{
+  const uint32_t n = 50;
+  ZipfTable table(n, 0.7, 1.0, ZipfTable::ALIAS);
+
+  std::vector<uint32_t> counts(n + 1);
+  const uint32_t nSamples = 1000000;
+  for (uint32_t step = 1; step <= nSamples; ++step) {
+    uint32_t rank = table.Sample(static_cast<double>(step) / nSamples);
+    BOOST_REQUIRE_GE(rank, 1);
+    BOOST_REQUIRE_LE(rank, n);
+    counts[rank]++;
+  }
+
+  for (uint32_t rank = 1; rank <= n; ++rank) {
+    BOOST_CHECK_CLOSE(static_cast<double>(counts[rank]) / nSamples, table.GetProbability(rank),
+                      1.0);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Shared)
+{
+  shared_ptr<const ZipfTable> table1 = ZipfTable::Get(100, 0.7, 0.7);
+  shared_ptr<const ZipfTable> table2 = ZipfTable::Get(100, 0.7, 0.7);
+  shared_ptr<const ZipfTable> table3 = ZipfTable::Get(100, 0.7, 0.8);
+  shared_ptr<const ZipfTable> table4 = ZipfTable::Get(100, 0.7, 0.7, ZipfTable::ALIAS);
+
+  BOOST_CHECK_EQUAL(table1, table2);
+  BOOST_CHECK_NE(table1, table3);
+  BOOST_CHECK_NE(table1, table4);
+  BOOST_CHECK_EQUAL(table4->GetMethod(), ZipfTable::ALIAS);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,142 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/topology/annotated-topology-reader.hpp"
+
+#include "ns3/mobility-model.h"
+#include "ns3/names.h"
+#include "ns3/net-device.h"
+
+#include "../../tests-common.hpp"
+
+#include <boost/filesystem.hpp>
+#include <fstream>
+
+namespace ns3 {
+namespace ndn {
+
+const boost::filesystem::path TEST_TOPO_TXT =
+  boost::filesystem::path(TEST_CONFIG_PATH) / "topo.txt";
+const boost::filesystem::path TEST_TOPO_BIN =
+  boost::filesystem::path(TEST_CONFIG_PATH) / "topo.bin";
+
+class AnnotatedTopologyReaderFixture : public CleanupFixture
+{
+public:
+  AnnotatedTopologyReaderFixture()
+  {
+    boost::filesystem::create_directories(TEST_CONFIG_PATH);
+
+    std::ofstream file(TEST_TOPO_TXT.string().c_str());
+    file << "router\n\n"
+         << "#node city  y x mpi-partition\n"
+         << "A1  NA  1 1\r\n"
+         << "B1  NA  80  -40\n"
+         << "C1  NA  80  40\n\n"
+         << "link\n\n"
+         << "# from  to  capacity  metric  delay queue\n"
+         << "A1      B1  10Mbps    100 1ms 100\n"
+         << "A1      C1  10Mbps    50  2ms\n"
+         << "C1      A1  10Mbps    50  2ms\n"
+         << "B1      C1  1Mbps     1\n";
+  }
+
+  ~AnnotatedTopologyReaderFixture()
+  {
+    boost::filesystem::remove(TEST_TOPO_TXT);
+    boost::filesystem::remove(TEST_TOPO_BIN);
+  }
+};
+
+BOOST_FIXTURE_TEST_SUITE(UtilsTopologyAnnotatedTopologyReader, AnnotatedTopologyReaderFixture)
+
+BOOST_AUTO_TEST_CASE(Read)
+{
+  AnnotatedTopologyReader reader("", 2.0);
+  reader.SetFileName(TEST_TOPO_TXT.string());
+  NodeContainer nodes = reader.Read();
+
+  BOOST_REQUIRE_EQUAL(nodes.GetN(), 3);
+  BOOST_CHECK_EQUAL(Names::FindName(nodes.Get(0)), "A1");
+  BOOST_CHECK_EQUAL(Names::FindName(nodes.Get(2)), "C1");
+
+  Vector position = Names::Find<Node>("B1")->GetObject<MobilityModel>()->GetPosition();
+  BOOST_CHECK_EQUAL(position.x, -80);
+  BOOST_CHECK_EQUAL(position.y, -160);
+
+  // reversed C1-A1 is a duplicate
+  const std::list<TopologyReader::Link>& links = reader.GetLinks();
+  BOOST_REQUIRE_EQUAL(links.size(), 3);
+
+  const TopologyReader::Link& link = links.back();
+  BOOST_CHECK_EQUAL(link.GetFromNodeName(), "B1");
+  BOOST_CHECK_EQUAL(link.GetToNodeName(), "C1");
+  BOOST_CHECK_EQUAL(link.GetAttribute("DataRate"), "1Mbps");
+  BOOST_CHECK_EQUAL(link.GetAttribute("OSPF"), "1");
+  std::string delay;
+  BOOST_CHECK(!link.GetAttributeFailSafe("Delay", delay));
+  BOOST_CHECK(link.GetFromNetDevice() != 0);
+}
+
+BOOST_AUTO_TEST_CASE(BinaryTopology)
+{
+  std::vector<Vector> positions;
+  {
+    AnnotatedTopologyReader reader("", 2.0);
+    reader.SetFileName(TEST_TOPO_TXT.string());
+    NodeContainer nodes = reader.Read();
+    for (uint32_t i = 0; i < nodes.GetN(); ++i) {
+      positions.push_back(nodes.Get(i)->GetObject<MobilityModel>()->GetPosition());
+    }
+
+    reader.SaveBinaryTopology(TEST_TOPO_BIN.string());
+  }
+
+  Simulator::Destroy();
+  Names::Clear();
+
+  AnnotatedTopologyReader reader;
+  NodeContainer nodes = reader.ReadBinaryTopology(TEST_TOPO_BIN.string());
+
+  BOOST_REQUIRE_EQUAL(nodes.GetN(), 3);
+  for (uint32_t i = 0; i < nodes.GetN(); ++i) {
+    Vector position = nodes.Get(i)->GetObject<MobilityModel>()->GetPosition();
+    BOOST_CHECK_EQUAL(position.x, positions[i].x);
+    BOOST_CHECK_EQUAL(position.y, positions[i].y);
+  }
+  BOOST_CHECK_EQUAL(Names::FindName(nodes.Get(1)), "B1");
+
+  const std::list<TopologyReader::Link>& links = reader.GetLinks();
+  BOOST_REQUIRE_EQUAL(links.size(), 3);
+
+  const TopologyReader::Link& link = links.front();
+  BOOST_CHECK_EQUAL(link.GetFromNodeName(), "A1");
+  BOOST_CHECK_EQUAL(link.GetToNodeName(), "B1");
+  BOOST_CHECK_EQUAL(link.GetAttribute("DataRate"), "10Mbps");
+  BOOST_CHECK_EQUAL(link.GetAttribute("OSPF"), "100");
+  BOOST_CHECK_EQUAL(link.GetAttribute("Delay"), "1ms");
+  BOOST_CHECK_EQUAL(link.GetAttribute("MaxPackets"), "100");
+  BOOST_CHECK(link.GetFromNetDevice() != 0);
+  BOOST_CHECK(link.GetToNetDevice()->GetNode() == Names::Find<Node>("B1"));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,137 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/topology/topology-generator.hpp"
+
+#include "ns3/mobility-model.h"
+#include "ns3/names.h"
+#include "ns3/net-device.h"
+
+#include "../../tests-common.hpp"
+
+#include <set>
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(UtilsTopologyTopologyGenerator, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(Chain)
+{
+  TopologyGenerator generator("", 2.0);
+  generator.SetLinkAttributes("10Mbps", "5ms", "3");
+  NodeContainer nodes = generator.CreateChain(5);
+
+  BOOST_REQUIRE_EQUAL(nodes.GetN(), 5);
+  BOOST_CHECK_EQUAL(Names::FindName(nodes.Get(4)), "node-4");
+  BOOST_CHECK_EQUAL(nodes.Get(4)->GetObject<MobilityModel>()->GetPosition().x, 8);
+
+  const std::list<TopologyReader::Link>& links = generator.GetLinks();
+  BOOST_REQUIRE_EQUAL(links.size(), 4);
+
+  const TopologyReader::Link& link = links.front();
+  BOOST_CHECK_EQUAL(link.GetFromNodeName(), "node-0");
+  BOOST_CHECK_EQUAL(link.GetToNodeName(), "node-1");
+  BOOST_CHECK_EQUAL(link.GetAttribute("DataRate"), "10Mbps");
+  BOOST_CHECK_EQUAL(link.GetAttribute("Delay"), "5ms");
+  BOOST_CHECK_EQUAL(link.GetAttribute("OSPF"), "3");
+  BOOST_CHECK(link.GetFromNetDevice() != 0);
+  BOOST_CHECK_EQUAL(nodes.Get(0)->GetNDevices(), 1);
+  BOOST_CHECK_EQUAL(nodes.Get(2)->GetNDevices(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(Grid)
+{
+  TopologyGenerator generator;
+  generator.SetNamePrefix("grid-");
+  NodeContainer nodes = generator.CreateGrid(3, 4);
+
+  BOOST_REQUIRE_EQUAL(nodes.GetN(), 12);
+  BOOST_CHECK_EQUAL(generator.GetLinks().size(), 17);
+  BOOST_CHECK(Names::Find<Node>("grid-11") == nodes.Get(11));
+
+  Vector position = nodes.Get(6)->GetObject<MobilityModel>()->GetPosition();
+  BOOST_CHECK_EQUAL(position.x, 2);
+  BOOST_CHECK_EQUAL(position.y, 1);
+
+  std::string delay;
+  BOOST_CHECK(!generator.GetLinks().front().GetAttributeFailSafe("Delay", delay));
+}
+
+BOOST_AUTO_TEST_CASE(Trees)
+{
+  {
+    TopologyGenerator generator;
+    NodeContainer nodes = generator.CreateTree(2, 3);
+    BOOST_CHECK_EQUAL(nodes.GetN(), 15);
+    BOOST_CHECK_EQUAL(generator.GetLinks().size(), 14);
+    BOOST_CHECK_EQUAL(nodes.Get(0)->GetNDevices(), 2);
+    BOOST_CHECK_EQUAL(nodes.Get(1)->GetNDevices(), 3);
+    BOOST_CHECK_EQUAL(nodes.Get(14)->GetNDevices(), 1);
+  }
+
+  {
+    TopologyGenerator generator;
+    generator.SetNamePrefix("fat-");
+    NodeContainer nodes = generator.CreateFatTree(4);
+
+    // 4 core, 8 aggregation, 8 edge switches, and 16 hosts
+    BOOST_CHECK_EQUAL(nodes.GetN(), 36);
+    BOOST_CHECK_EQUAL(generator.GetLinks().size(), 48);
+    for (uint32_t i = 0; i < 20; ++i) {
+      BOOST_CHECK_EQUAL(nodes.Get(i)->GetNDevices(), 4);
+    }
+    for (uint32_t i = 20; i < 36; ++i) {
+      BOOST_CHECK_EQUAL(nodes.Get(i)->GetNDevices(), 1);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(RandomGraphs)
+{
+  {
+    TopologyGenerator generator;
+    NodeContainer nodes = generator.CreateBarabasiAlbert(100, 2);
+
+    // 3 links of the initial clique, and 2 links for each of the remaining 97 nodes
+    BOOST_CHECK_EQUAL(nodes.GetN(), 100);
+    BOOST_CHECK_EQUAL(generator.GetLinks().size(), 197);
+
+    std::set<std::pair<std::string, std::string>> pairs;
+    for (const auto& link : generator.GetLinks()) {
+      BOOST_CHECK_NE(link.GetFromNodeName(), link.GetToNodeName());
+      BOOST_CHECK(pairs.insert(std::make_pair(link.GetFromNodeName(), link.GetToNodeName()))
+                    .second);
+    }
+  }
+
+  {
+    TopologyGenerator generator;
+    generator.SetNamePrefix("waxman-");
+    // with very large beta, the link probability does not depend on the distance
+    NodeContainer nodes = generator.CreateWaxman(20, 1.0, 1e6);
+    BOOST_CHECK_EQUAL(nodes.GetN(), 20);
+    BOOST_CHECK_EQUAL(generator.GetLinks().size(), 20 * 19 / 2);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,89 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/tracers/ndn-tracer-sampler.hpp"
+
+#include "ns3/global-value.h"
+#include "ns3/uinteger.h"
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(UtilsTracersNdnTracerSampler, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(NoSampling)
+{
+  TracerSampler sampler;
+  BOOST_CHECK_EQUAL(sampler.GetRate(), 1);
+  BOOST_CHECK_EQUAL(sampler.GetWeight(), 1.0);
+
+  for (uint64_t seq = 0; seq < 1000; ++seq) {
+    BOOST_REQUIRE(sampler.IsSampled(seq));
+    BOOST_REQUIRE(sampler.IsSampled(Name("/prefix").appendSequenceNumber(seq)));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Rate)
+{
+  TracerSampler sampler(100);
+  BOOST_CHECK_EQUAL(sampler.GetWeight(), 100.0);
+
+  size_t nSeqs = 0;
+  size_t nNames = 0;
+  for (uint64_t seq = 0; seq < 100000; ++seq) {
+    nSeqs += sampler.IsSampled(seq);
+    nNames += sampler.IsSampled(Name("/prefix").appendSequenceNumber(seq));
+  }
+
+  // estimates (sampled count * weight) are within 10% of the real count
+  BOOST_CHECK_CLOSE(nSeqs * sampler.GetWeight(), 100000.0, 10.0);
+  BOOST_CHECK_CLOSE(nNames * sampler.GetWeight(), 100000.0, 10.0);
+}
+
+BOOST_AUTO_TEST_CASE(Deterministic)
+{
+  TracerSampler sampler1(10);
+  TracerSampler sampler2(10);
+
+  Name name("/prefix");
+  for (uint64_t seq = 0; seq < 1000; ++seq) {
+    Name seqName = Name(name).appendSequenceNumber(seq);
+    Name encodedName(seqName.wireEncode());
+
+    BOOST_REQUIRE_EQUAL(sampler1.IsSampled(seqName), sampler2.IsSampled(seqName));
+    BOOST_REQUIRE_EQUAL(sampler1.IsSampled(seqName), sampler1.IsSampled(encodedName));
+    BOOST_REQUIRE_EQUAL(sampler1.IsSampled(seq), sampler2.IsSampled(seq));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(GlobalDefault)
+{
+  Config::SetGlobal("NdnTracerSamplingRate", UintegerValue(16));
+  TracerSampler sampler;
+  Config::SetGlobal("NdnTracerSamplingRate", UintegerValue(1));
+
+  BOOST_CHECK_EQUAL(sampler.GetRate(), 16);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,131 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-binding-table.hpp"
+#include "ndn-name-hash.hpp"
+
+#include <algorithm>
+
+namespace ns3 {
+namespace ndn {
+
+BindingTable::Bindings::iterator
+BindingTable::FindExact(const Name& prefix, uint64_t hash)
+{
+  auto range = m_bindings.equal_range(hash);
+  for (auto i = range.first; i != range.second; ++i) {
+    if (i->second.prefix == prefix) {
+      return i;
+    }
+  }
+  return m_bindings.end();
+}
+
+std::pair<BindingTable::Binding*, bool>
+BindingTable::Insert(const Name& prefix, const Name& locator, Time expiry /* = Time::Max()*/)
+{
+  uint64_t hash = NameHash::Hash(prefix);
+  auto i = FindExact(prefix, hash);
+  if (i != m_bindings.end()) {
+    i->second.locator = locator;
+    i->second.expiry = expiry;
+    return {&i->second, false};
+  }
+
+  i = m_bindings.emplace(hash, Binding{prefix, locator, expiry});
+  if (m_nBindingsOfLength.size() <= prefix.size()) {
+    m_nBindingsOfLength.resize(prefix.size() + 1);
+  }
+  ++m_nBindingsOfLength[prefix.size()];
+  return {&i->second, true};
+}
+
+bool
+BindingTable::Erase(const Name& prefix)
+{
+  auto i = FindExact(prefix, NameHash::Hash(prefix));
+  if (i == m_bindings.end()) {
+    return false;
+  }
+
+  --m_nBindingsOfLength[prefix.size()];
+  m_bindings.erase(i);
+  return true;
+}
+
+BindingTable::Binding*
+BindingTable::FindExactMatch(const Name& prefix)
+{
+  auto i = FindExact(prefix, NameHash::Hash(prefix));
+  return i != m_bindings.end() ? &i->second : nullptr;
+}
+
+const BindingTable::Binding*
+BindingTable::FindLongestPrefixMatch(const Name& name) const
+{
+  const Binding* match = nullptr;
+  size_t maxLength = std::min(name.size() + 1, m_nBindingsOfLength.size());
+
+  uint64_t hash = NameHash::OFFSET_BASIS;
+  for (size_t length = 0; length < maxLength; ++length) {
+    if (length > 0) {
+      hash = NameHash::Extend(hash, name.get(length - 1));
+    }
+    if (m_nBindingsOfLength[length] == 0) {
+      continue;
+    }
+
+    auto range = m_bindings.equal_range(hash);
+    for (auto i = range.first; i != range.second; ++i) {
+      const Name& prefix = i->second.prefix;
+      if (prefix.size() == length && prefix.isPrefixOf(name)) {
+        match = &i->second; // longer prefixes are checked later
+        break;
+      }
+    }
+  }
+  return match;
+}
+
+size_t
+BindingTable::EraseExpired(Time now)
+{
+  size_t nErased = 0;
+  for (auto i = m_bindings.begin(); i != m_bindings.end();) {
+    if (i->second.IsExpired(now)) {
+      --m_nBindingsOfLength[i->second.prefix.size()];
+      i = m_bindings.erase(i);
+      ++nErased;
+    }
+    else {
+      ++i;
+    }
+  }
+  return nErased;
+}
+
+void
+BindingTable::Clear()
+{
+  m_bindings.clear();
+  m_nBindingsOfLength.clear();
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,116 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDNSIM_UTILS_NDN_BINDING_TABLE_HPP
+#define NDNSIM_UTILS_NDN_BINDING_TABLE_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include <unordered_map>
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-helpers
+ * @brief Table of name prefix to locator bindings, as maintained by a home agent
+ *
+ * Bindings are hashed by their prefix names, hashes are computed incrementally over the name
+ * components, so that longest prefix match of a name requires a single pass over its components
+ * and one hash lookup per prefix length for which any binding exists.  No URI conversion or
+ * temporary names are involved.
+ *
+ * Bindings may have a limited lifetime.  The table does not expire them on its own: lookups
+ * return expired bindings as well, which the owner should check with Binding::IsExpired and erase
+ * (or refresh by inserting again).  EraseExpired removes all expired bindings at once.
+ *
+ * Pointers to bindings remain valid until the binding is erased.
+ */
+class BindingTable {
+public:
+  struct Binding {
+    Name prefix;
+    Name locator;
+    Time expiry; ///< @brief Time::Max() if the binding does not expire
+
+    bool
+    IsExpired(Time now) const
+    {
+      return expiry <= now;
+    }
+  };
+
+  /**
+   * @brief Insert binding for @p prefix or update locator and expiry of the existing one
+   * @return the binding and whether it has been newly inserted
+   */
+  std::pair<Binding*, bool>
+  Insert(const Name& prefix, const Name& locator, Time expiry = Time::Max());
+
+  /**
+   * @brief Erase binding for @p prefix
+   * @return whether the binding existed
+   */
+  bool
+  Erase(const Name& prefix);
+
+  /**
+   * @brief Find binding for exactly @p prefix
+   */
+  Binding*
+  FindExactMatch(const Name& prefix);
+
+  /**
+   * @brief Find binding with the longest prefix of @p name
+   */
+  const Binding*
+  FindLongestPrefixMatch(const Name& name) const;
+
+  size_t
+  GetSize() const
+  {
+    return m_bindings.size();
+  }
+
+  /**
+   * @brief Erase all bindings that are expired at @p now
+   * @return number of erased bindings
+   */
+  size_t
+  EraseExpired(Time now);
+
+  void
+  Clear();
+
+private:
+  typedef std::unordered_multimap<uint64_t, Binding> Bindings;
+
+  Bindings::iterator
+  FindExact(const Name& prefix, uint64_t hash);
+
+private:
+  Bindings m_bindings;
+  std::vector<size_t> m_nBindingsOfLength; ///< @brief number of bindings per prefix length
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDNSIM_UTILS_NDN_BINDING_TABLE_HPP
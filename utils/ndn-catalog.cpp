@@ -29,7 +29,6 @@
 #include <vector>
 #include <algorithm>
 #include <math.h>
-#include <random>
 
 using namespace std;
 
@@ -39,7 +38,18 @@ namespace ndn {
 	
 using ::ndn::Name;
 
+static const objectProperties NO_OBJECT = {0.0, 0};
+
 Catalog::Catalog()
+  : m_rand(CreateObject<UniformRandomVariable>())
+  , m_objectPopularity(CreateObject<NormalRandomVariable>())
+  , m_objectSize(CreateObject<NormalRandomVariable>())
+  , m_userPopulationSize(0)
+  , m_maxRequests(0)
+  , m_objectPopularityAlpha(0)
+  , m_objectPopularityStddev(0)
+  , m_objectSizeMean(0)
+  , m_objectSizeStddev(0)
 {
 }
 
@@ -53,7 +63,8 @@ Catalog::addUser(Ptr<Node> user)
   m_users.push_back(user);
 }
 
-vector<Ptr<Node>> Catalog::getUsers()
+const vector<Ptr<Node>>&
+Catalog::getUsers() const
 {
   return m_users;
 }
@@ -64,7 +75,8 @@ Catalog::addRouter(Ptr<Node> router)
   m_routers.push_back(router);
 }
 
-vector<Ptr<Node>> Catalog::getRouters()
+const vector<Ptr<Node>>&
+Catalog::getRouters() const
 {
   return m_routers;
 }
@@ -120,6 +132,15 @@ Catalog::setObjectSize(double mean, double stddev)
 //  m_objectLifetimeStddev = stddev;
 //}
 
+int64_t
+Catalog::AssignStreams(int64_t stream)
+{
+  m_rand->SetStream(stream);
+  m_objectPopularity->SetStream(stream + 1);
+  m_objectSize->SetStream(stream + 2);
+  return 3;
+}
+
 void
 Catalog::initializeCatalog()
 {
@@ -131,19 +152,26 @@ Catalog::initializeCatalog()
 void
 Catalog::initializePopularity()
 {
-  m_objectPopularityBase = 0;
-  for (uint32_t k = 1; k <= m_userPopulationSize; k++)
-  {
-    m_popularityIndex.push_back(k);
-    m_objectPopularityBase += pow(k, -1*m_objectPopularityAlpha);
+  m_popularity = ZipfTable::Get(m_userPopulationSize, 0.0, m_objectPopularityAlpha);
+
+  m_popularityIndex.resize(m_userPopulationSize);
+  for (uint32_t k = 1; k <= m_userPopulationSize; k++) {
+    m_popularityIndex[k - 1] = k;
   }
-  random_shuffle(m_popularityIndex.begin(), m_popularityIndex.end());
+
+  // Fisher-Yates shuffle using simulation's random stream
+  for (uint32_t i = m_userPopulationSize; i > 1; i--) {
+    swap(m_popularityIndex[i - 1], m_popularityIndex[m_rand->GetInteger(0, i - 1)]);
+  }
+
+  // variance is given by "stddev", as in the original implementation
+  m_objectPopularity->SetAttribute("Mean", DoubleValue(0.0));
+  m_objectPopularity->SetAttribute("Variance", DoubleValue(m_objectPopularityStddev));
 }
 
 void
 Catalog::initializeObjectSize()
 {
-  m_objectSize = CreateObject<NormalRandomVariable>();
   m_objectSize->SetAttribute("Mean", DoubleValue(m_objectSizeMean));
   m_objectSize->SetAttribute("Variance", DoubleValue(m_objectSizeStddev));
 }
@@ -165,6 +193,8 @@ Catalog::getUserPopularity()
 double
 Catalog::getNextPopularity()
 {
+  NS_ASSERT_MSG(!m_popularityIndex.empty(), "More users than userPopulationSize");
+
   uint32_t index = m_popularityIndex.back();
   m_popularityIndex.pop_back();
 
@@ -172,24 +202,19 @@ Catalog::getNextPopularity()
   double popularity = getPopularity(index);
   double scaleFactor = m_maxRequests/mostPopular;
 
-  //cout << "#1: " << mostPopular << " / #" << index << ": " << popularity << " / requests: " << m_maxRequests << " / scale: " << scaleFactor << endl;  
-
   return (popularity * scaleFactor) / m_userPopulationSize;
 }
 
 double
 Catalog::getPopularity(uint32_t rank)
 {
-  return pow(rank, -1*m_objectPopularityAlpha)/m_objectPopularityBase;
+  return m_popularity->GetProbability(rank);
 }
 
 double
 Catalog::getNextObjectPopularity(double popularity)
 {
-  m_objectPopularity = CreateObject<NormalRandomVariable>();
-  m_objectPopularity->SetAttribute("Mean", DoubleValue(popularity));
-  m_objectPopularity->SetAttribute("Variance", DoubleValue(m_objectPopularityStddev));
-  return m_objectPopularity->GetValue();
+  return popularity + m_objectPopularity->GetValue();
 }
 
 /**
@@ -209,27 +234,81 @@ Catalog::getNextObjectSize()
 //}
 
 void
-Catalog::addObject(Name objectName, double popularity)
+Catalog::reserveObjects(uint32_t nObjects)
 {
-  objectProperties properties;
+  m_objects.reserve(nObjects);
+  m_objectExists.reserve(nObjects);
+}
 
+void
+Catalog::addObject(uint32_t objectId, double popularity)
+{
+  if (objectId >= m_objects.size()) {
+    m_objects.resize(objectId + 1, NO_OBJECT);
+    m_objectExists.resize(objectId + 1, false);
+  }
+
+  objectProperties& properties = m_objects[objectId];
   properties.popularity = getNextObjectPopularity(popularity);
   properties.size = getNextObjectSize();
 //  properties.lifetime = getNextObjectLifetime();
 
-  m_objects[objectName] = properties;
+  m_objectExists[objectId] = true;
+}
+
+bool
+Catalog::hasObject(uint32_t objectId) const
+{
+  return objectId < m_objectExists.size() && m_objectExists[objectId];
+}
+
+const objectProperties&
+Catalog::getObjectProperties(uint32_t objectId) const
+{
+  if (!hasObject(objectId)) {
+    return NO_OBJECT;
+  }
+  return m_objects[objectId];
+}
+
+void
+Catalog::removeObject(uint32_t objectId)
+{
+  if (hasObject(objectId)) {
+    m_objects[objectId] = NO_OBJECT;
+    m_objectExists[objectId] = false;
+  }
+}
+
+void
+Catalog::addObject(const Name& objectName, double popularity)
+{
+  auto id = m_objectIds.find(objectName);
+  if (id == m_objectIds.end()) {
+    // first id after all used ones, so it cannot clash with objects added by id
+    id = m_objectIds.insert(make_pair(objectName, m_objects.size())).first;
+  }
+  addObject(id->second, popularity);
 }
 
 objectProperties
-Catalog::getObjectProperties(Name objectName)
+Catalog::getObjectProperties(const Name& objectName) const
 {
-  return m_objects[objectName];
+  auto id = m_objectIds.find(objectName);
+  if (id == m_objectIds.end()) {
+    return NO_OBJECT;
+  }
+  return getObjectProperties(id->second);
 }
 
 void
-Catalog::removeObject(Name objectName)
+Catalog::removeObject(const Name& objectName)
 {
-  m_objects.erase(objectName);
+  auto id = m_objectIds.find(objectName);
+  if (id != m_objectIds.end()) {
+    removeObject(id->second);
+    m_objectIds.erase(id);
+  }
 }
 
 } // namespace ndn
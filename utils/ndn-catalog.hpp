@@ -25,8 +25,11 @@
 #include "ns3/core-module.h"
 #include "ns3/network-module.h"
 
+#include "ns3/ndnSIM/utils/ndn-zipf-table.hpp"
+
 #include <ndn-cxx/name.hpp>
 #include <list>
+#include <map>
 #include <vector>
 
 using namespace std;
@@ -42,6 +45,16 @@ struct objectProperties {
 //  double lifetime;
 };
 
+/**
+ * @brief Catalog of simulated objects, their popularity and size
+ *
+ * Objects are identified by integer ids, which index a flat array of properties (16 bytes per
+ * object, so 10^7 objects fit in ~160 MB).  Name-based methods are kept for compatibility and
+ * map names to ids with an additional index, which costs far more memory per object.
+ *
+ * Popularity of ranks is taken from a ZipfTable shared with other catalogs and consumers that use
+ * the same parameters, and all random values are drawn from the catalog's own random streams.
+ */
 class Catalog : public Object
 {
 public:
@@ -51,14 +64,14 @@ public:
   void
   addUser(Ptr<Node> user);
 
-  vector<Ptr<Node>>
-  getUsers();
+  const vector<Ptr<Node>>&
+  getUsers() const;
 
   void
   addRouter(Ptr<Node> router);
 
-  vector<Ptr<Node>>
-  getRouters();
+  const vector<Ptr<Node>>&
+  getRouters() const;
 
   Time
   getMaxSimulationTime();
@@ -87,18 +100,46 @@ public:
   void
   initializeCatalog();
 
+  /**
+   * @brief Pre-allocate memory for objects with ids [0, nObjects)
+   */
   void
-  addObject(Name objectName, double popularity);
+  reserveObjects(uint32_t nObjects);
+
+  void
+  addObject(uint32_t objectId, double popularity);
+
+  bool
+  hasObject(uint32_t objectId) const;
+
+  /**
+   * @brief Get properties of the object (zero popularity and size if there is no such object)
+   */
+  const objectProperties&
+  getObjectProperties(uint32_t objectId) const;
+
+  void
+  removeObject(uint32_t objectId);
+
+  void
+  addObject(const Name& objectName, double popularity);
 
   objectProperties
-  getObjectProperties(Name objectName);
+  getObjectProperties(const Name& objectName) const;
 
   void
-  removeObject(Name objectName);
+  removeObject(const Name& objectName);
 
   double
   getUserPopularity();
 
+  /**
+   * @brief Assign stream numbers to the random variables of the catalog
+   * @returns number of streams used
+   */
+  int64_t
+  AssignStreams(int64_t stream);
+
 private: 
   void
   initializePopularity();
@@ -128,9 +169,11 @@ private:
   vector<Ptr<Node>> m_users;
   vector<Ptr<Node>> m_routers;
 
-  vector<uint32_t> m_popularityIndex;
+  vector<uint32_t> m_popularityIndex; ///< @brief shuffled user ranks, consumed from the back
+  shared_ptr<const ZipfTable> m_popularity;
 
-  Ptr<NormalRandomVariable> m_objectPopularity;
+  Ptr<UniformRandomVariable> m_rand;
+  Ptr<NormalRandomVariable> m_objectPopularity; ///< @brief zero-mean variation of popularity
   Ptr<NormalRandomVariable> m_objectSize;
 //  Ptr<NormalRandomVariable> m_objectLifetime;
 
@@ -139,7 +182,6 @@ private:
 
   double m_maxRequests;
   double m_objectPopularityAlpha;
-  double m_objectPopularityBase;
   double m_objectPopularityStddev;
 
   double m_objectSizeMean;
@@ -148,7 +190,9 @@ private:
 //  double m_objectLifetimeMean;
 //  double m_objectLifetimeStddev;
 
-  map<Name, objectProperties> m_objects;
+  vector<objectProperties> m_objects;
+  vector<bool> m_objectExists;
+  map<Name, uint32_t> m_objectIds; ///< @brief ids of objects added by name
 };
 
 } // namespace ndn
@@ -0,0 +1,78 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-consistent-hash-ring.hpp"
+#include "ndn-name-hash.hpp"
+
+#include "ns3/assert.h"
+
+namespace ns3 {
+namespace ndn {
+
+ConsistentHashRing::ConsistentHashRing(uint32_t nVirtualNodes /* = 64*/)
+  : m_nVirtualNodes(nVirtualNodes)
+  , m_nReplicas(0)
+{
+  NS_ASSERT(m_nVirtualNodes > 0);
+}
+
+void
+ConsistentHashRing::AddReplica(const Name& replica)
+{
+  uint64_t hash = NameHash::Hash(replica);
+  bool isNew = false;
+  for (uint32_t i = 0; i < m_nVirtualNodes; ++i) {
+    isNew = m_ring.emplace(NameHash::Mix(hash + i), replica).second || isNew;
+  }
+  if (isNew) {
+    ++m_nReplicas;
+  }
+}
+
+void
+ConsistentHashRing::RemoveReplica(const Name& replica)
+{
+  uint64_t hash = NameHash::Hash(replica);
+  bool isRemoved = false;
+  for (uint32_t i = 0; i < m_nVirtualNodes; ++i) {
+    auto point = m_ring.find(NameHash::Mix(hash + i));
+    if (point != m_ring.end() && point->second == replica) {
+      m_ring.erase(point);
+      isRemoved = true;
+    }
+  }
+  if (isRemoved) {
+    --m_nReplicas;
+  }
+}
+
+const Name&
+ConsistentHashRing::GetReplica(const Name& name) const
+{
+  NS_ASSERT(!m_ring.empty());
+
+  auto point = m_ring.lower_bound(NameHash::Mix(NameHash::Hash(name)));
+  if (point == m_ring.end()) {
+    point = m_ring.begin(); // wrap around
+  }
+  return point->second;
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,73 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDNSIM_UTILS_NDN_CONSISTENT_HASH_RING_HPP
+#define NDNSIM_UTILS_NDN_CONSISTENT_HASH_RING_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include <map>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-helpers
+ * @brief Consistent assignment of names (e.g., producer prefixes) to a set of named replicas
+ *        (e.g., home agents)
+ *
+ * Each replica is placed on a 64-bit hash ring at several pseudo-random points (virtual nodes),
+ * a name is assigned to the replica owning the first point following the hash of the name.
+ * Adding or removing a replica only reassigns names to or from that replica, and the
+ * assignment does not depend on the order in which replicas were added.
+ */
+class ConsistentHashRing {
+public:
+  explicit
+  ConsistentHashRing(uint32_t nVirtualNodes = 64);
+
+  void
+  AddReplica(const Name& replica);
+
+  void
+  RemoveReplica(const Name& replica);
+
+  size_t
+  GetNReplicas() const
+  {
+    return m_nReplicas;
+  }
+
+  /**
+   * @brief Get replica responsible for @p name
+   * @pre GetNReplicas() > 0
+   */
+  const Name&
+  GetReplica(const Name& name) const;
+
+private:
+  uint32_t m_nVirtualNodes;
+  size_t m_nReplicas;
+  std::map<uint64_t, Name> m_ring;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDNSIM_UTILS_NDN_CONSISTENT_HASH_RING_HPP
@@ -0,0 +1,84 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-data-template.hpp"
+
+#include <ndn-cxx/encoding/encoding-buffer.hpp>
+#include <ndn-cxx/encoding/tlv.hpp>
+
+namespace ns3 {
+namespace ndn {
+
+shared_ptr<Data>
+DataTemplate::MakeVirtualData(uint32_t payloadSize, Time freshness, uint32_t signature,
+                              const Name& keyLocator)
+{
+  auto data = make_shared<Data>();
+  data->setFreshnessPeriod(::ndn::time::milliseconds(freshness.GetMilliSeconds()));
+
+  data->setContent(make_shared< ::ndn::Buffer>(payloadSize));
+
+  Signature dataSignature;
+  SignatureInfo signatureInfo(static_cast< ::ndn::tlv::SignatureTypeValue>(255));
+
+  if (keyLocator.size() > 0) {
+    signatureInfo.setKeyLocator(keyLocator);
+  }
+
+  dataSignature.setInfo(signatureInfo);
+  dataSignature.setValue(::ndn::makeNonNegativeIntegerBlock(::ndn::tlv::SignatureValue, signature));
+
+  data->setSignature(dataSignature);
+  return data;
+}
+
+void
+DataTemplate::Set(const Data& data)
+{
+  const Block& wire = data.wireEncode();
+  wire.parse();
+
+  // Name is always the first element of Data
+  auto name = wire.elements_begin();
+  BOOST_ASSERT(name != wire.elements_end() && name->type() == ::ndn::tlv::Name);
+
+  m_tail = make_shared< ::ndn::Buffer>(name->end(), wire.value_end());
+}
+
+shared_ptr<Data>
+DataTemplate::Instantiate(const Name& name) const
+{
+  BOOST_ASSERT(IsSet());
+
+  const Block& nameWire = name.wireEncode();
+  size_t valueLength = nameWire.size() + m_tail->size();
+  size_t totalLength = ::ndn::tlv::sizeOfVarNumber(::ndn::tlv::Data)
+                       + ::ndn::tlv::sizeOfVarNumber(valueLength) + valueLength;
+
+  ::ndn::EncodingBuffer encoder(totalLength, 0);
+  encoder.prependByteArray(m_tail->buf(), m_tail->size());
+  encoder.prependByteArray(nameWire.wire(), nameWire.size());
+  encoder.prependVarNumber(valueLength);
+  encoder.prependVarNumber(::ndn::tlv::Data);
+
+  return make_shared<Data>(encoder.block());
+}
+
+} // namespace ndn
+} // namespace ns3
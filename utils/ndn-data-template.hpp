@@ -0,0 +1,84 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDNSIM_UTILS_NDN_DATA_TEMPLATE_HPP
+#define NDNSIM_UTILS_NDN_DATA_TEMPLATE_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include <ndn-cxx/encoding/buffer.hpp>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-helpers
+ * @brief Pre-encoded Data packet, from which Data packets with different names can be cheaply
+ *        produced
+ *
+ * All elements of the Data packet following the name (MetaInfo, Content, SignatureInfo,
+ * SignatureValue, and any other fields) are encoded once when the template is set.  Producing
+ * a Data packet then only requires splicing the encoded name in front of the pre-encoded
+ * elements into a single exactly-sized buffer, instead of allocating and filling the payload,
+ * constructing the signature, and encoding the whole packet.
+ */
+class DataTemplate {
+public:
+  /**
+   * @brief Create Data packet with virtual (zero-filled) payload and a fake signature, as
+   *        produced by Producer application
+   * @param payloadSize size of the virtual payload
+   * @param freshness freshness period (0 for unlimited freshness)
+   * @param signature value of the fake signature
+   * @param keyLocator name used as key locator; not included if empty
+   */
+  static shared_ptr<Data>
+  MakeVirtualData(uint32_t payloadSize, Time freshness, uint32_t signature,
+                  const Name& keyLocator);
+
+  /**
+   * @brief Pre-encode all elements of @p data except its name
+   */
+  void
+  Set(const Data& data);
+
+  /**
+   * @brief Check whether the template has been set
+   */
+  bool
+  IsSet() const
+  {
+    return m_tail != nullptr;
+  }
+
+  /**
+   * @brief Produce Data packet (with wire encoding) from the template, named @p name
+   * @pre IsSet()
+   */
+  shared_ptr<Data>
+  Instantiate(const Name& name) const;
+
+private:
+  ::ndn::ConstBufferPtr m_tail; ///< @brief encoded elements of the Data packet after the name
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDNSIM_UTILS_NDN_DATA_TEMPLATE_HPP
@@ -0,0 +1,126 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-memory-usage.hpp"
+
+#include "ns3/node.h"
+
+#include "model/ndn-l3-protocol.hpp"
+#include "model/cs/ndn-content-store.hpp"
+
+#include "daemon/fw/forwarder.hpp"
+#include "daemon/table/cs.hpp"
+#include "daemon/table/fib.hpp"
+#include "daemon/table/name-tree.hpp"
+#include "daemon/table/pit.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+uint64_t
+TableMemoryUsage::GetTotal() const
+{
+  return m_csTrie + m_csPolicy + m_csData + m_pit + m_fib + m_nameTree;
+}
+
+TableMemoryUsage&
+TableMemoryUsage::operator+=(const TableMemoryUsage& other)
+{
+  m_csEntries += other.m_csEntries;
+  m_csTrie += other.m_csTrie;
+  m_csPolicy += other.m_csPolicy;
+  m_csData += other.m_csData;
+  m_pitEntries += other.m_pitEntries;
+  m_pit += other.m_pit;
+  m_fibEntries += other.m_fibEntries;
+  m_fib += other.m_fib;
+  m_nameTree += other.m_nameTree;
+  return *this;
+}
+
+uint64_t
+TableMemoryUsage::GetNameMemoryUsage(const Name& name)
+{
+  return sizeof(Name) + name.size() * sizeof(name::Component) + name.wireEncode().size();
+}
+
+uint64_t
+TableMemoryUsage::GetDataMemoryUsage(const Data& data)
+{
+  // name components reference the Data's wire encoding
+  return sizeof(Data) + data.getName().size() * sizeof(name::Component)
+         + (data.hasWire() ? data.wireEncode().size() : data.getContent().size());
+}
+
+uint64_t
+TableMemoryUsage::GetInterestMemoryUsage(const Interest& interest)
+{
+  // name components reference the Interest's wire encoding
+  return sizeof(Interest) + interest.getName().size() * sizeof(name::Component)
+         + (interest.hasWire() ? interest.wireEncode().size()
+                               : interest.getName().wireEncode().size());
+}
+
+TableMemoryUsage
+TableMemoryUsage::Get(Ptr<Node> node)
+{
+  TableMemoryUsage usage;
+
+  Ptr<L3Protocol> l3 = node->GetObject<L3Protocol>();
+  if (l3 == nullptr) {
+    return usage;
+  }
+  shared_ptr<nfd::Forwarder> forwarder = l3->getForwarder();
+
+  Ptr<ContentStore> cs = node->GetObject<ContentStore>();
+  if (cs != nullptr) {
+    usage += cs->GetMemoryUsage();
+  }
+  else {
+    for (const auto& entry : forwarder->getCs()) {
+      usage.m_csEntries++;
+      usage.m_csData += sizeof(entry) + GetDataMemoryUsage(entry.getData());
+    }
+  }
+
+  for (const auto& entry : forwarder->getPit()) {
+    usage.m_pitEntries++;
+    usage.m_pit += sizeof(entry) + GetInterestMemoryUsage(entry.getInterest());
+
+    for (const auto& in : entry.getInRecords()) {
+      usage.m_pit += sizeof(in) + GetInterestMemoryUsage(in.getInterest());
+    }
+    for (const auto& out : entry.getOutRecords()) {
+      usage.m_pit += sizeof(out);
+    }
+  }
+
+  for (const auto& entry : forwarder->getFib()) {
+    usage.m_fibEntries++;
+    usage.m_fib += sizeof(entry) + GetNameMemoryUsage(entry.getPrefix())
+                   + entry.getNextHops().size() * sizeof(nfd::fib::NextHop);
+  }
+
+  usage.m_nameTree = forwarder->getNameTree().size() * sizeof(nfd::name_tree::Entry);
+
+  return usage;
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,93 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDNSIM_UTILS_NDN_MEMORY_USAGE_HPP
+#define NDNSIM_UTILS_NDN_MEMORY_USAGE_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ns3/ptr.h"
+
+namespace ns3 {
+
+class Node;
+
+namespace ndn {
+
+/**
+ * @ingroup ndn-helpers
+ * @brief Approximate memory used by NDN tables of a node (or a set of nodes)
+ *
+ * Unlike MemUsage, which reports resident set size of the whole process, the numbers are
+ * obtained by walking the data structures and adding up sizes of the objects and buffers they
+ * hold, so they can be attributed to individual tables and entries.  Allocator overhead is not
+ * accounted for.
+ */
+struct TableMemoryUsage {
+  uint64_t m_csEntries = 0;    ///< @brief number of cached Data packets
+  uint64_t m_csTrie = 0;       ///< @brief ndnSIM content store trie nodes and hash buckets
+  uint64_t m_csPolicy = 0;     ///< @brief replacement policy hooks and containers
+  uint64_t m_csData = 0;       ///< @brief cached Data packets and CS entry objects
+  uint64_t m_pitEntries = 0;   ///< @brief number of PIT entries
+  uint64_t m_pit = 0;          ///< @brief PIT entries with their in/out records
+  uint64_t m_fibEntries = 0;   ///< @brief number of FIB entries
+  uint64_t m_fib = 0;          ///< @brief FIB entries with their next hops
+  uint64_t m_nameTree = 0;     ///< @brief NFD name tree entries
+
+  /**
+   * @brief Get total number of bytes in all tables
+   */
+  uint64_t
+  GetTotal() const;
+
+  TableMemoryUsage&
+  operator+=(const TableMemoryUsage& other);
+
+  /**
+   * @brief Get memory usage of all NDN tables on the node
+   *
+   * Content store accounting uses ContentStore::GetMemoryUsage if the ndnSIM content store is
+   * aggregated to the node, NFD's content store otherwise
+   */
+  static TableMemoryUsage
+  Get(Ptr<Node> node);
+
+  /**
+   * @brief Approximate number of bytes used by the name (components and their buffers)
+   */
+  static uint64_t
+  GetNameMemoryUsage(const Name& name);
+
+  /**
+   * @brief Approximate number of bytes used by the Data packet
+   */
+  static uint64_t
+  GetDataMemoryUsage(const Data& data);
+
+  /**
+   * @brief Approximate number of bytes used by the Interest packet
+   */
+  static uint64_t
+  GetInterestMemoryUsage(const Interest& interest);
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDNSIM_UTILS_NDN_MEMORY_USAGE_HPP
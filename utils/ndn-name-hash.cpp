@@ -0,0 +1,57 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-name-hash.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+static const uint64_t FNV_PRIME = 0x100000001b3ULL;
+
+const uint64_t NameHash::OFFSET_BASIS;
+
+uint64_t
+NameHash::Hash(const Name& name)
+{
+  uint64_t hash = OFFSET_BASIS;
+  for (const auto& component : name) {
+    hash = Extend(hash, component);
+  }
+  return hash;
+}
+
+uint64_t
+NameHash::Extend(uint64_t hash, const name::Component& component)
+{
+  for (auto i = component.value_begin(); i != component.value_end(); ++i) {
+    hash = (hash ^ *i) * FNV_PRIME;
+  }
+  return (hash ^ component.type()) * FNV_PRIME;
+}
+
+uint64_t
+NameHash::Mix(uint64_t key)
+{
+  key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  key = (key ^ (key >> 27)) * 0x94d049bb133111ebULL;
+  return key ^ (key >> 31);
+}
+
+} // namespace ndn
+} // namespace ns3
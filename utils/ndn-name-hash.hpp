@@ -0,0 +1,64 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDNSIM_UTILS_NDN_NAME_HASH_HPP
+#define NDNSIM_UTILS_NDN_NAME_HASH_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @brief Non-cryptographic hashes of names used by simulator-side tables and samplers
+ *
+ * Names are hashed with FNV-1a over component types and values, so the hash does not depend on
+ * whether the name is wire-encoded.  The hash can be computed incrementally, one component at
+ * a time, for prefixes of the same name.
+ */
+class NameHash {
+public:
+  static const uint64_t OFFSET_BASIS = 0xcbf29ce484222325ULL; ///< @brief hash of empty name
+
+  /**
+   * @brief FNV-1a hash of @p name
+   */
+  static uint64_t
+  Hash(const Name& name);
+
+  /**
+   * @brief Extend hash of a prefix with the next @p component
+   */
+  static uint64_t
+  Extend(uint64_t hash, const name::Component& component);
+
+  /**
+   * @brief splitmix64 finalizer
+   *
+   * FNV-1a leaves similar names close to each other; mixed hash can be used for uniform
+   * sampling or placement on a ring
+   */
+  static uint64_t
+  Mix(uint64_t key);
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDNSIM_UTILS_NDN_NAME_HASH_HPP
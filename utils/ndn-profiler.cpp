@@ -0,0 +1,269 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-profiler.hpp"
+
+#include "ns3/simulator.h"
+#include "ns3/log.h"
+#include "ns3/global-value.h"
+#include "ns3/string.h"
+#include "ns3/node-list.h"
+
+#include "model/cs/ndn-content-store.hpp"
+
+#include <boost/lexical_cast.hpp>
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <unistd.h>
+
+#include "mem-usage.hpp"
+
+NS_LOG_COMPONENT_DEFINE("ndn.Profiler");
+
+namespace ns3 {
+namespace ndn {
+
+bool Profiler::s_isEnabled = false;
+Profiler::Counter Profiler::s_counters[Profiler::STAGE_COUNT] = {};
+Profiler::Counter Profiler::s_lastCounters[Profiler::STAGE_COUNT] = {};
+
+static GlobalValue g_profile("NdnProfile",
+                             "Start ndnSIM self-profiler when StackHelper is created: "
+                             "<file>[:<period in seconds>] (\"-\" for standard output), "
+                             "empty to disable",
+                             StringValue(""), MakeStringChecker());
+
+static shared_ptr<std::ostream> g_os;
+static EventId g_printEvent;
+static std::chrono::steady_clock::time_point g_lastRealTime;
+
+void
+Profiler::Install(const std::string& file, Time period)
+{
+  if (!IsCompiledIn()) {
+    NS_LOG_WARN("ndnSIM is configured without --enable-ndnsim-profiling, profiler will report "
+                "only zero counters");
+  }
+
+  shared_ptr<std::ostream> outputStream;
+  if (file != "-") {
+    shared_ptr<std::ofstream> os(new std::ofstream());
+    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
+
+    if (!os->is_open()) {
+      NS_LOG_ERROR("File " << file << " cannot be opened for writing. Profiling disabled");
+      return;
+    }
+
+    outputStream = os;
+  }
+  else {
+    outputStream = shared_ptr<std::ostream>(&std::cout, std::bind([]{}));
+  }
+
+  Destroy();
+
+  g_os = outputStream;
+  s_isEnabled = true;
+  g_lastRealTime = std::chrono::steady_clock::now();
+
+  PrintHeader(*g_os);
+  *g_os << "\n";
+
+  g_printEvent = Simulator::Schedule(period, &Profiler::PeriodicPrinter, period);
+}
+
+void
+Profiler::InstallFromEnvironment()
+{
+  if (s_isEnabled) {
+    return;
+  }
+
+  std::string value;
+  const char* environment = std::getenv("NDNSIM_PROFILE");
+  if (environment != nullptr && *environment != '\0') {
+    value = environment;
+  }
+  else {
+    StringValue globalValue;
+    g_profile.GetValue(globalValue);
+    value = globalValue.Get();
+  }
+  if (value.empty()) {
+    return;
+  }
+
+  std::string file(value);
+  Time period = Seconds(1.0);
+
+  size_t pos = file.rfind(':');
+  if (pos != std::string::npos) {
+    try {
+      period = Seconds(boost::lexical_cast<double>(file.substr(pos + 1)));
+      file = file.substr(0, pos);
+    }
+    catch (const boost::bad_lexical_cast&) {
+      NS_LOG_WARN("Cannot parse reporting period in " << value
+                  << ", using whole value as file name");
+    }
+  }
+
+  Install(file, period);
+}
+
+void
+Profiler::Destroy()
+{
+  g_printEvent.Cancel();
+  s_isEnabled = false;
+  g_os.reset();
+
+  for (size_t i = 0; i < STAGE_COUNT; ++i) {
+    s_counters[i] = Counter();
+    s_lastCounters[i] = Counter();
+  }
+}
+
+bool
+Profiler::IsCompiledIn()
+{
+#ifdef NDNSIM_PROFILING
+  return true;
+#else
+  return false;
+#endif // NDNSIM_PROFILING
+}
+
+uint64_t
+Profiler::GetCount(Stage stage)
+{
+  return s_counters[stage].m_count;
+}
+
+uint64_t
+Profiler::GetNanoseconds(Stage stage)
+{
+  return s_counters[stage].m_nanoseconds;
+}
+
+const char*
+Profiler::GetStageName(Stage stage)
+{
+  switch (stage) {
+  case NETDEVICE_SEND:
+    return "NetDeviceSend";
+  case NETDEVICE_RECEIVE:
+    return "NetDeviceReceive";
+  case BLOCK_HEADER_SERIALIZE:
+    return "BlockHeaderSerialize";
+  case BLOCK_HEADER_DESERIALIZE:
+    return "BlockHeaderDeserialize";
+  case CS_LOOKUP:
+    return "CsLookup";
+  case CS_INSERT:
+    return "CsInsert";
+  case APP_LINK_DISPATCH:
+    return "AppLinkDispatch";
+  case TRACER_CALLBACK:
+    return "TracerCallback";
+  default:
+    return "Unknown";
+  }
+}
+
+bool
+Profiler::IsStageAvailable(Stage stage)
+{
+  if (stage != CS_LOOKUP && stage != CS_INSERT) {
+    return true;
+  }
+
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); ++node) {
+    if ((*node)->GetObject<ContentStore>() != nullptr) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void
+Profiler::PrintHeader(std::ostream& os)
+{
+  os << "Time"
+     << "\t"
+     << "RealTime"
+     << "\t"
+     << "Stage"
+     << "\t"
+     << "Count"
+     << "\t"
+     << "EventsPerSec"
+     << "\t"
+     << "NsPerPacket"
+     << "\t"
+     << "RssMiB";
+}
+
+void
+Profiler::Print(std::ostream& os)
+{
+  auto now = std::chrono::steady_clock::now();
+  double realTime = std::chrono::duration<double>(now - g_lastRealTime).count();
+  g_lastRealTime = now;
+
+  double rss = MemUsage::Get() / 1024.0 / 1024.0;
+  double simTime = Simulator::Now().ToDouble(Time::S);
+
+  bool isCsAvailable = IsStageAvailable(CS_LOOKUP);
+
+  for (size_t i = 0; i < STAGE_COUNT; ++i) {
+    Stage stage = static_cast<Stage>(i);
+    uint64_t count = s_counters[i].m_count - s_lastCounters[i].m_count;
+    uint64_t ns = s_counters[i].m_nanoseconds - s_lastCounters[i].m_nanoseconds;
+    s_lastCounters[i] = s_counters[i];
+
+    os << simTime << "\t" << realTime << "\t" << GetStageName(stage) << "\t";
+    if (!isCsAvailable && (stage == CS_LOOKUP || stage == CS_INSERT)) {
+      // NFD's content store is not instrumented
+      os << "n/a\tn/a\tn/a";
+    }
+    else {
+      os << count << "\t" << (realTime > 0 ? count / realTime : 0) << "\t"
+         << (count > 0 ? static_cast<double>(ns) / count : 0);
+    }
+    os << "\t" << rss << "\n";
+  }
+}
+
+void
+Profiler::PeriodicPrinter(Time period)
+{
+  if (g_os == nullptr) {
+    return;
+  }
+
+  Print(*g_os);
+  g_printEvent = Simulator::Schedule(period, &Profiler::PeriodicPrinter, period);
+}
+
+} // namespace ndn
+} // namespace ns3
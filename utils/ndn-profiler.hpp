@@ -0,0 +1,207 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDNSIM_UTILS_NDN_PROFILER_HPP
+#define NDNSIM_UTILS_NDN_PROFILER_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ns3/nstime.h"
+
+#include <chrono>
+#include <iosfwd>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-helpers
+ * @brief Self-profiling of the main per-packet processing stages of ndnSIM
+ *
+ * Each instrumented stage (NetDevice send/receive, BlockHeader (de)serialization, CS
+ * lookup/insert, app-link dispatch, tracer callbacks) is counted and timed with wall-clock
+ * (std::chrono::steady_clock, not the simulated ndn-cxx clock) scopes.  Periodically, the
+ * profiler reports number of events per stage, events per second of real time, average
+ * nanoseconds spent per packet in the stage, and resident set size of the process.
+ *
+ * Instrumentation is compiled in only when ndnSIM is configured with
+ * `--enable-ndnsim-profiling` (defines NDNSIM_PROFILING); otherwise NDNSIM_PROFILE_SCOPE
+ * expands to nothing.  When compiled in, scopes are still inactive (a single branch) until the
+ * profiler is started either explicitly:
+ *
+ *     ndn::Profiler::Install("profile.txt", Seconds(1.0));
+ *
+ * or by setting NDNSIM_PROFILE environment variable or NdnProfile global value to
+ * `<file>[:<period in seconds>]` (use "-" as file name for standard output), which are checked
+ * when ndn::StackHelper is created:
+ *
+ *     NDNSIM_PROFILE=-:0.5 ./waf --run=ndn-simple
+ *     ./waf --run="ndn-simple --NdnProfile=profile.txt:0.5"
+ *
+ * CS_LOOKUP and CS_INSERT are instrumented only in ndnSIM content stores (see
+ * StackHelper::SetOldContentStore).  Without them, NFD's content store is used and these stages
+ * are reported as "n/a".
+ */
+class Profiler {
+public:
+  enum Stage {
+    NETDEVICE_SEND = 0,
+    NETDEVICE_RECEIVE,
+    BLOCK_HEADER_SERIALIZE,
+    BLOCK_HEADER_DESERIALIZE,
+    CS_LOOKUP,
+    CS_INSERT,
+    APP_LINK_DISPATCH,
+    TRACER_CALLBACK,
+
+    STAGE_COUNT
+  };
+
+  /**
+   * @brief RAII helper measuring time spent within the enclosing block
+   */
+  class Scope {
+  public:
+    explicit Scope(Stage stage)
+      : m_stage(stage)
+      , m_isActive(s_isEnabled)
+    {
+      if (m_isActive) {
+        m_start = std::chrono::steady_clock::now();
+      }
+    }
+
+    ~Scope()
+    {
+      if (m_isActive) {
+        Record(m_stage, std::chrono::steady_clock::now() - m_start);
+      }
+    }
+
+  private:
+    Stage m_stage;
+    bool m_isActive;
+    std::chrono::steady_clock::time_point m_start;
+  };
+
+public:
+  /**
+   * @brief Start periodic reporting to the file
+   *
+   * @param file File where the report will be written ("-" for standard output)
+   * @param period How often the report should be written
+   */
+  static void
+  Install(const std::string& file, Time period = Seconds(1.0));
+
+  /**
+   * @brief Start periodic reporting if NDNSIM_PROFILE environment variable or NdnProfile
+   *        global value is set (the environment variable takes precedence)
+   *
+   * Has no effect if the profiler is already running
+   */
+  static void
+  InstallFromEnvironment();
+
+  /**
+   * @brief Stop reporting and reset all counters
+   */
+  static void
+  Destroy();
+
+  static bool
+  IsEnabled()
+  {
+    return s_isEnabled;
+  }
+
+  /**
+   * @brief Check whether instrumentation was compiled in
+   */
+  static bool
+  IsCompiledIn();
+
+  static void
+  Record(Stage stage, std::chrono::steady_clock::duration duration)
+  {
+    s_counters[stage].m_count++;
+    s_counters[stage].m_nanoseconds +=
+      std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+  }
+
+  /**
+   * @brief Get total number of events recorded for the stage
+   */
+  static uint64_t
+  GetCount(Stage stage);
+
+  /**
+   * @brief Get total real time spent in the stage (nanoseconds)
+   */
+  static uint64_t
+  GetNanoseconds(Stage stage);
+
+  static const char*
+  GetStageName(Stage stage);
+
+  /**
+   * @brief Check whether the stage is instrumented in the current simulation
+   *
+   * CS stages are instrumented only if at least one node uses an ndnSIM content store
+   */
+  static bool
+  IsStageAvailable(Stage stage);
+
+  static void
+  PrintHeader(std::ostream& os);
+
+  /**
+   * @brief Print statistics accumulated since the previous call
+   */
+  static void
+  Print(std::ostream& os);
+
+private:
+  static void
+  PeriodicPrinter(Time period);
+
+private:
+  /// @cond include_hidden
+  struct Counter {
+    uint64_t m_count;
+    uint64_t m_nanoseconds;
+  };
+  /// @endcond
+
+  static bool s_isEnabled;
+  static Counter s_counters[STAGE_COUNT];
+  static Counter s_lastCounters[STAGE_COUNT];
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#ifdef NDNSIM_PROFILING
+#define NDNSIM_PROFILE_SCOPE(stage)                                                                \
+  ::ns3::ndn::Profiler::Scope ndnsimProfilerScope(::ns3::ndn::Profiler::stage)
+#else
+#define NDNSIM_PROFILE_SCOPE(stage)
+#endif // NDNSIM_PROFILING
+
+#endif // NDNSIM_UTILS_NDN_PROFILER_HPP
@@ -0,0 +1,122 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-seq-state-table.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+static const size_t INITIAL_SIZE_LOG2 = 4;
+
+SeqStateTable::SeqStateTable()
+{
+  Clear();
+}
+
+void
+SeqStateTable::Clear()
+{
+  m_slots.assign(static_cast<size_t>(1) << INITIAL_SIZE_LOG2, Slot());
+  m_mask = m_slots.size() - 1;
+  m_shift = 32 - INITIAL_SIZE_LOG2;
+  m_size = 0;
+}
+
+size_t
+SeqStateTable::FindSlot(uint32_t seq) const
+{
+  size_t i = GetHome(seq);
+  while (m_slots[i].isUsed && m_slots[i].seq != seq) {
+    i = (i + 1) & m_mask;
+  }
+  return i;
+}
+
+SeqState*
+SeqStateTable::Find(uint32_t seq)
+{
+  size_t i = FindSlot(seq);
+  return m_slots[i].isUsed ? &m_slots[i].state : nullptr;
+}
+
+SeqState&
+SeqStateTable::Insert(uint32_t seq)
+{
+  size_t i = FindSlot(seq);
+  if (m_slots[i].isUsed) {
+    return m_slots[i].state;
+  }
+
+  // keep load factor under 1/2, so probe sequences stay short
+  if (2 * (m_size + 1) > m_slots.size()) {
+    Grow();
+    i = FindSlot(seq);
+  }
+
+  m_slots[i].seq = seq;
+  m_slots[i].isUsed = true;
+  m_slots[i].state = SeqState();
+  m_size++;
+  return m_slots[i].state;
+}
+
+void
+SeqStateTable::Erase(uint32_t seq)
+{
+  size_t i = FindSlot(seq);
+  if (!m_slots[i].isUsed) {
+    return;
+  }
+
+  // backward-shift deletion: move following entries of the cluster into the hole if their home
+  // slot is not between the hole and their current position
+  size_t hole = i;
+  size_t j = i;
+  while (true) {
+    j = (j + 1) & m_mask;
+    if (!m_slots[j].isUsed) {
+      break;
+    }
+    size_t home = GetHome(m_slots[j].seq);
+    if (((j - home) & m_mask) >= ((j - hole) & m_mask)) {
+      m_slots[hole] = m_slots[j];
+      hole = j;
+    }
+  }
+  m_slots[hole].isUsed = false;
+  m_size--;
+}
+
+void
+SeqStateTable::Grow()
+{
+  std::vector<Slot> slots(m_slots.size() * 2, Slot());
+  slots.swap(m_slots);
+  m_mask = m_slots.size() - 1;
+  m_shift--;
+
+  for (const Slot& slot : slots) {
+    if (slot.isUsed) {
+      m_slots[FindSlot(slot.seq)] = slot;
+    }
+  }
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,110 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDNSIM_UTILS_NDN_SEQ_STATE_TABLE_HPP
+#define NDNSIM_UTILS_NDN_SEQ_STATE_TABLE_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ns3/nstime.h"
+
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @brief State of an outstanding sequence number of a consumer application
+ */
+struct SeqState {
+  Time firstSent;      ///< @brief time of the first transmission
+  Time lastSent;       ///< @brief time of the last transmission
+  Time timeoutSent;    ///< @brief transmission time retransmission timeout is counted from
+  uint32_t retxCount;  ///< @brief number of transmissions
+  bool pendingTimeout; ///< @brief retransmission timeout is being tracked
+  bool pendingRetx;    ///< @brief sequence number is queued for retransmission
+};
+
+/**
+ * @ingroup ndn-apps
+ * @brief Open-addressing hash table of per-sequence-number consumer state
+ *
+ * All records are stored in a single array (linear probing, backward-shift deletion), so
+ * insert, lookup, and erase do not allocate memory except when the table grows.  Pointers
+ * returned by Find and Insert are invalidated by a subsequent Insert or Erase.
+ */
+class SeqStateTable {
+public:
+  SeqStateTable();
+
+  /**
+   * @brief Find state of the sequence number, nullptr if there is none
+   */
+  SeqState*
+  Find(uint32_t seq);
+
+  /**
+   * @brief Find state of the sequence number or insert a zero-initialized one
+   */
+  SeqState&
+  Insert(uint32_t seq);
+
+  void
+  Erase(uint32_t seq);
+
+  void
+  Clear();
+
+  size_t
+  GetSize() const
+  {
+    return m_size;
+  }
+
+private:
+  struct Slot {
+    uint32_t seq;
+    bool isUsed;
+    SeqState state;
+  };
+
+  size_t
+  GetHome(uint32_t seq) const
+  {
+    // Fibonacci hashing: consecutive sequence numbers are spread over the whole table
+    return (static_cast<uint32_t>(seq * 2654435769u) >> m_shift) & m_mask;
+  }
+
+  size_t
+  FindSlot(uint32_t seq) const;
+
+  void
+  Grow();
+
+private:
+  std::vector<Slot> m_slots;
+  size_t m_mask;
+  uint32_t m_shift;
+  size_t m_size;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDNSIM_UTILS_NDN_SEQ_STATE_TABLE_HPP
@@ -0,0 +1,171 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-streaming-stats.hpp"
+
+#include "ns3/abort.h"
+
+#include <cmath>
+#include <limits>
+
+namespace ns3 {
+namespace ndn {
+
+StreamingStats::StreamingStats(double relativeAccuracy /* = 0.01*/)
+{
+  NS_ABORT_MSG_IF(relativeAccuracy <= 0 || relativeAccuracy >= 1,
+                  "Relative accuracy should be in (0, 1) range");
+
+  m_gamma = (1 + relativeAccuracy) / (1 - relativeAccuracy);
+  m_logGamma = std::log(m_gamma);
+
+  Reset();
+}
+
+void
+StreamingStats::Reset()
+{
+  m_count = 0;
+  m_mean = 0;
+  m_m2 = 0;
+  m_min = std::numeric_limits<double>::infinity();
+  m_max = -std::numeric_limits<double>::infinity();
+
+  m_positive.clear();
+  m_negative.clear();
+  m_zero = 0;
+}
+
+void
+StreamingStats::Add(double value)
+{
+  m_count++;
+  double delta = value - m_mean;
+  m_mean += delta / m_count;
+  m_m2 += delta * (value - m_mean);
+
+  m_min = std::min(m_min, value);
+  m_max = std::max(m_max, value);
+
+  if (value > 0) {
+    m_positive[GetBucket(value)]++;
+  }
+  else if (value < 0) {
+    m_negative[GetBucket(-value)]++;
+  }
+  else {
+    m_zero++;
+  }
+}
+
+void
+StreamingStats::Merge(const StreamingStats& other)
+{
+  NS_ABORT_MSG_IF(m_gamma != other.m_gamma, "Cannot merge summaries with different accuracy");
+
+  if (other.m_count == 0) {
+    return;
+  }
+
+  // parallel version of Welford's algorithm (Chan et al.)
+  uint64_t count = m_count + other.m_count;
+  double delta = other.m_mean - m_mean;
+  m_mean += delta * other.m_count / count;
+  m_m2 += other.m_m2 + delta * delta * m_count * other.m_count / count;
+  m_count = count;
+
+  m_min = std::min(m_min, other.m_min);
+  m_max = std::max(m_max, other.m_max);
+
+  for (const auto& bucket : other.m_positive) {
+    m_positive[bucket.first] += bucket.second;
+  }
+  for (const auto& bucket : other.m_negative) {
+    m_negative[bucket.first] += bucket.second;
+  }
+  m_zero += other.m_zero;
+}
+
+double
+StreamingStats::GetVariance() const
+{
+  if (m_count < 2) {
+    return 0;
+  }
+  return m_m2 / (m_count - 1);
+}
+
+double
+StreamingStats::GetStdDev() const
+{
+  return std::sqrt(GetVariance());
+}
+
+int32_t
+StreamingStats::GetBucket(double value) const
+{
+  return static_cast<int32_t>(std::ceil(std::log(value) / m_logGamma));
+}
+
+double
+StreamingStats::GetBucketValue(int32_t bucket) const
+{
+  // value in the middle (in terms of relative error) of (gamma^(bucket-1), gamma^bucket]
+  return 2 * std::pow(m_gamma, bucket) / (m_gamma + 1);
+}
+
+double
+StreamingStats::GetQuantile(double q) const
+{
+  if (m_count == 0) {
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+
+  uint64_t rank = static_cast<uint64_t>(std::max(0.0, std::min(q, 1.0)) * (m_count - 1));
+
+  double value = 0;
+  uint64_t seen = 0;
+
+  // negative values: from the largest magnitude down
+  for (auto i = m_negative.rbegin(); i != m_negative.rend(); ++i) {
+    seen += i->second;
+    if (seen > rank) {
+      value = -GetBucketValue(i->first);
+      return std::max(m_min, std::min(value, m_max));
+    }
+  }
+
+  seen += m_zero;
+  if (seen > rank) {
+    return 0;
+  }
+
+  for (const auto& bucket : m_positive) {
+    seen += bucket.second;
+    if (seen > rank) {
+      value = GetBucketValue(bucket.first);
+      break;
+    }
+  }
+
+  return std::max(m_min, std::min(value, m_max));
+}
+
+} // namespace ndn
+} // namespace ns3
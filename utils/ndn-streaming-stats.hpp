@@ -0,0 +1,122 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDNSIM_UTILS_NDN_STREAMING_STATS_HPP
+#define NDNSIM_UTILS_NDN_STREAMING_STATS_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include <map>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-helpers
+ * @brief Constant-memory summary of a stream of values
+ *
+ * Mean and variance are maintained using Welford's online algorithm.  Quantiles are estimated
+ * using a sketch with logarithmically-sized buckets (value v is placed into bucket
+ * ceil(log_gamma |v|)), so any returned quantile is within the configured relative accuracy of
+ * the exact one, while the number of buckets grows only with log of the value range.
+ */
+class StreamingStats {
+public:
+  /**
+   * @param relativeAccuracy relative accuracy of quantile estimates (e.g., 0.01 for 1%)
+   */
+  explicit StreamingStats(double relativeAccuracy = 0.01);
+
+  void
+  Add(double value);
+
+  /**
+   * @brief Merge another summary with the same relative accuracy into this one
+   */
+  void
+  Merge(const StreamingStats& other);
+
+  void
+  Reset();
+
+  uint64_t
+  GetCount() const
+  {
+    return m_count;
+  }
+
+  double
+  GetMean() const
+  {
+    return m_mean;
+  }
+
+  /**
+   * @brief Get sample variance (0 if there are less than 2 values)
+   */
+  double
+  GetVariance() const;
+
+  double
+  GetStdDev() const;
+
+  double
+  GetMin() const
+  {
+    return m_min;
+  }
+
+  double
+  GetMax() const
+  {
+    return m_max;
+  }
+
+  /**
+   * @brief Estimate @p q -quantile (0 <= q <= 1) of the values
+   */
+  double
+  GetQuantile(double q) const;
+
+private:
+  int32_t
+  GetBucket(double value) const;
+
+  double
+  GetBucketValue(int32_t bucket) const;
+
+private:
+  double m_gamma;
+  double m_logGamma;
+
+  uint64_t m_count;
+  double m_mean;
+  double m_m2;
+  double m_min;
+  double m_max;
+
+  std::map<int32_t, uint64_t> m_positive;
+  std::map<int32_t, uint64_t> m_negative;
+  uint64_t m_zero;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDNSIM_UTILS_NDN_STREAMING_STATS_HPP
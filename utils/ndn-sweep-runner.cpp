@@ -0,0 +1,257 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-sweep-runner.hpp"
+
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+
+#include "utils/tracers/l2-rate-tracer.hpp"
+#include "utils/tracers/ndn-app-delay-tracer.hpp"
+#include "utils/tracers/ndn-cs-tracer.hpp"
+#include "utils/tracers/ndn-l3-rate-tracer.hpp"
+#include "utils/tracers/ndn-memory-tracer.hpp"
+#include "utils/tracers/ndn-path-stretch-tracer.hpp"
+
+#ifdef NS3_MPI
+#include "ns3/mpi-interface.h"
+#endif
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <thread>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <sys/wait.h>
+#include <unistd.h>
+
+NS_LOG_COMPONENT_DEFINE("ndn.SweepRunner");
+
+namespace ns3 {
+namespace ndn {
+
+SweepRunner::SweepRunner()
+  : m_maxProcesses(std::max(1u, std::thread::hardware_concurrency()))
+{
+}
+
+void
+SweepRunner::AddPoint(const Point& point)
+{
+  m_points.push_back(point);
+}
+
+void
+SweepRunner::AddDimension(const std::string& name, const std::vector<std::string>& values)
+{
+  if (m_points.empty()) {
+    m_points.push_back(Point());
+  }
+
+  std::vector<Point> points;
+  points.reserve(m_points.size() * values.size());
+  for (const Point& point : m_points) {
+    for (const std::string& value : values) {
+      points.push_back(point);
+      points.back()[name] = value;
+    }
+  }
+  m_points.swap(points);
+}
+
+const std::vector<SweepRunner::Point>&
+SweepRunner::GetPoints() const
+{
+  return m_points;
+}
+
+void
+SweepRunner::SetMaxProcesses(uint32_t maxProcesses)
+{
+  m_maxProcesses = std::max(1u, maxProcesses);
+}
+
+std::string
+SweepRunner::GetPointName(const Point& point)
+{
+  std::string name;
+  for (const auto& parameter : point) {
+    if (!name.empty()) {
+      name += "-";
+    }
+    name += parameter.first + "=" + parameter.second;
+  }
+  return name;
+}
+
+std::string
+SweepRunner::GetOutputFileName(const std::string& result, size_t index)
+{
+  return result + ".run-" + std::to_string(index);
+}
+
+uint32_t
+SweepRunner::Run(const RunCallback& callback, const std::string& result)
+{
+#ifdef NS3_MPI
+  if (MpiInterface::IsEnabled()) {
+    NS_FATAL_ERROR("SweepRunner cannot be used in distributed simulation");
+  }
+#endif
+  NS_ASSERT_MSG(Simulator::Now().IsZero(), "Template simulation must not be started");
+
+  // otherwise buffered output would be written by every child
+  std::cout.flush();
+  std::cerr.flush();
+  std::fflush(nullptr);
+
+  std::map<pid_t, size_t> running;
+  std::vector<bool> isFailed(m_points.size(), false);
+  uint32_t nFailed = 0;
+  size_t next = 0;
+
+  while (next < m_points.size() || !running.empty()) {
+    while (next < m_points.size() && running.size() < m_maxProcesses) {
+      pid_t pid = fork();
+      if (pid < 0) {
+        NS_FATAL_ERROR("Cannot fork run " << GetPointName(m_points[next]) << ": "
+                                          << std::strerror(errno));
+      }
+      if (pid == 0) {
+        RunPoint(callback, m_points[next], GetOutputFileName(result, next));
+      }
+
+      NS_LOG_DEBUG("Started run " << GetPointName(m_points[next]) << " (pid " << pid << ")");
+      running[pid] = next++;
+    }
+
+    int status = 0;
+    pid_t pid = waitpid(-1, &status, 0);
+    if (pid < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      NS_FATAL_ERROR("waitpid failed: " << std::strerror(errno));
+    }
+
+    auto run = running.find(pid);
+    if (run == running.end()) {
+      continue; // not one of the runs
+    }
+
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+      NS_LOG_ERROR("Run " << GetPointName(m_points[run->second]) << " failed");
+      isFailed[run->second] = true;
+      nFailed++;
+    }
+    else {
+      NS_LOG_INFO("Run " << GetPointName(m_points[run->second]) << " finished");
+    }
+    running.erase(run);
+  }
+
+  MergeOutputs(result, isFailed);
+  return nFailed;
+}
+
+void
+SweepRunner::RunPoint(const RunCallback& callback, const Point& point, const std::string& output)
+{
+  int status = 0;
+  try {
+    callback(point, output);
+
+    Simulator::Run();
+    Simulator::Destroy();
+
+    // flush and close trace files
+    L2RateTracer::Destroy();
+    AppDelayTracer::Destroy();
+    CsTracer::Destroy();
+    L3RateTracer::Destroy();
+    MemoryTracer::Destroy();
+    PathStretchTracer::Destroy();
+  }
+  catch (const std::exception& e) {
+    std::cerr << "Run " << GetPointName(point) << " failed: " << e.what() << std::endl;
+    status = 1;
+  }
+
+  std::cout.flush();
+  std::cerr.flush();
+  std::fflush(nullptr);
+
+  // skip destruction of the state inherited from the template
+  _exit(status);
+}
+
+void
+SweepRunner::MergeOutputs(const std::string& result, const std::vector<bool>& isFailed) const
+{
+  std::ofstream os(result.c_str(), std::ios_base::out | std::ios_base::trunc);
+  if (!os.is_open()) {
+    NS_LOG_ERROR("File " << result << " cannot be opened for writing. Run outputs are kept");
+    return;
+  }
+
+  // parameter names of the first point define the columns
+  std::vector<std::string> names;
+  if (!m_points.empty()) {
+    for (const auto& parameter : m_points.front()) {
+      names.push_back(parameter.first);
+    }
+  }
+
+  bool hasHeader = false;
+  for (size_t i = 0; i < m_points.size(); ++i) {
+    std::string output = GetOutputFileName(result, i);
+    std::ifstream is(output.c_str());
+    if (!is.is_open()) {
+      continue; // run did not write any output
+    }
+
+    std::string values;
+    for (const std::string& name : names) {
+      auto value = m_points[i].find(name);
+      values += (value != m_points[i].end() ? value->second : "NA") + "\t";
+    }
+
+    std::string line;
+    if (std::getline(is, line) && !hasHeader && !isFailed[i]) {
+      for (const std::string& name : names) {
+        os << name << "\t";
+      }
+      os << line << "\n";
+      hasHeader = true;
+    }
+
+    while (!isFailed[i] && std::getline(is, line)) {
+      os << values << line << "\n";
+    }
+
+    is.close();
+    std::remove(output.c_str());
+  }
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,129 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDNSIM_UTILS_NDN_SWEEP_RUNNER_HPP
+#define NDNSIM_UTILS_NDN_SWEEP_RUNNER_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include <functional>
+#include <map>
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-helpers
+ * @brief Runs a scenario for a set of parameter points, each run starting from a fully
+ *        initialized template simulation
+ *
+ * The scenario builds the template (topology, stack, routes) once and calls Run(), which forks
+ * a process for each point, so runs share the template state copy-on-write instead of repeating
+ * the setup.  In the child process, the run callback configures the point-specific parts
+ * (applications, attributes, tracers writing into the supplied file), then the simulation is run
+ * to completion.  Up to SetMaxProcesses() runs are executed concurrently.  Once all runs finish,
+ * their outputs are merged into a single table, with a leading column for each parameter.
+ *
+ * Example:
+ *
+ *     SweepRunner sweep;
+ *     sweep.AddDimension("cs", {"10", "100"});
+ *     sweep.AddDimension("req", {"1", "2", "5"});
+ *     sweep.Run([&] (const SweepRunner::Point& point, const std::string& output) {
+ *         ...
+ *         AppDelayTracer::InstallAll(output);
+ *       }, "app-delays.txt");
+ *
+ * @note Run() must be called before the template simulation is started.  Distributed (MPI)
+ *       simulations are not supported.
+ */
+class SweepRunner {
+public:
+  /**
+   * @brief Parameter values, indexed by parameter name
+   */
+  typedef std::map<std::string, std::string> Point;
+
+  /**
+   * @brief Callback to configure the run for @p point; tracer output should be written into
+   *        @p output to be merged into the result
+   */
+  typedef std::function<void(const Point& point, const std::string& output)> RunCallback;
+
+  SweepRunner();
+
+  /**
+   * @brief Add a single parameter point
+   */
+  void
+  AddPoint(const Point& point);
+
+  /**
+   * @brief Add parameter @p name with @p values, making the points a cartesian product of
+   *        the existing points and the values
+   */
+  void
+  AddDimension(const std::string& name, const std::vector<std::string>& values);
+
+  const std::vector<Point>&
+  GetPoints() const;
+
+  /**
+   * @brief Set maximum number of concurrently executed runs (default: number of hardware
+   *        threads)
+   */
+  void
+  SetMaxProcesses(uint32_t maxProcesses);
+
+  /**
+   * @brief Execute runs for all points and merge their outputs into @p result
+   * @return number of failed runs (their output is not included in the result)
+   */
+  uint32_t
+  Run(const RunCallback& callback, const std::string& result);
+
+  /**
+   * @brief Get printable name of the point, e.g., "cs=10-req=2"
+   */
+  static std::string
+  GetPointName(const Point& point);
+
+private:
+  /**
+   * @brief Execute run in the forked process, does not return
+   */
+  static void
+  RunPoint(const RunCallback& callback, const Point& point, const std::string& output);
+
+  void
+  MergeOutputs(const std::string& result, const std::vector<bool>& isFailed) const;
+
+  static std::string
+  GetOutputFileName(const std::string& result, size_t index);
+
+private:
+  std::vector<Point> m_points;
+  uint32_t m_maxProcesses;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDNSIM_UTILS_NDN_SWEEP_RUNNER_HPP
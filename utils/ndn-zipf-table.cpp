@@ -0,0 +1,168 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-zipf-table.hpp"
+
+#include "ns3/log.h"
+
+#include <algorithm>
+#include <map>
+#include <tuple>
+
+NS_LOG_COMPONENT_DEFINE("ndn.ZipfTable");
+
+namespace ns3 {
+namespace ndn {
+
+typedef std::tuple<uint32_t, double, double, ZipfTable::Method> ZipfTableKey;
+
+static std::map<ZipfTableKey, std::weak_ptr<const ZipfTable>> g_tables;
+
+shared_ptr<const ZipfTable>
+ZipfTable::Get(uint32_t n, double q, double s, Method method /* = BINARY_SEARCH*/)
+{
+  ZipfTableKey key(n, q, s, method);
+
+  auto i = g_tables.find(key);
+  if (i != g_tables.end()) {
+    shared_ptr<const ZipfTable> table = i->second.lock();
+    if (table != nullptr) {
+      return table;
+    }
+  }
+
+  // forget tables that nobody uses anymore
+  for (auto j = g_tables.begin(); j != g_tables.end();) {
+    if (j->second.expired()) {
+      j = g_tables.erase(j);
+    }
+    else {
+      ++j;
+    }
+  }
+
+  auto table = make_shared<const ZipfTable>(n, q, s, method);
+  g_tables[key] = table;
+  return table;
+}
+
+ZipfTable::ZipfTable(uint32_t n, double q, double s, Method method)
+  : m_n(n)
+  , m_q(q)
+  , m_s(s)
+  , m_method(method)
+  , m_norm(0)
+{
+  NS_LOG_DEBUG("Building table for N=" << m_n << ", q=" << m_q << ", s=" << m_s
+                                       << (m_method == ALIAS ? " (alias)" : " (binary search)"));
+
+  if (m_n == 0) {
+    return;
+  }
+
+  BuildCdf();
+  if (m_method == ALIAS) {
+    BuildAlias();
+  }
+}
+
+void
+ZipfTable::BuildCdf()
+{
+  m_cdf.resize(m_n + 1);
+
+  m_cdf[0] = 0.0;
+  for (uint32_t i = 1; i <= m_n; i++) {
+    m_cdf[i] = m_cdf[i - 1] + 1.0 / std::pow(i + m_q, m_s);
+  }
+  m_norm = m_cdf[m_n];
+
+  for (uint32_t i = 1; i <= m_n; i++) {
+    m_cdf[i] = m_cdf[i] / m_norm;
+  }
+}
+
+void
+ZipfTable::BuildAlias()
+{
+  // Vose's alias method
+  m_prob.resize(m_n);
+  m_alias.resize(m_n);
+
+  std::vector<uint32_t> small;
+  std::vector<uint32_t> large;
+  for (uint32_t i = 0; i < m_n; i++) {
+    m_prob[i] = (m_cdf[i + 1] - m_cdf[i]) * m_n;
+    m_alias[i] = i;
+    (m_prob[i] < 1.0 ? small : large).push_back(i);
+  }
+
+  while (!small.empty() && !large.empty()) {
+    uint32_t less = small.back();
+    small.pop_back();
+    uint32_t more = large.back();
+
+    m_alias[less] = more;
+    m_prob[more] = (m_prob[more] + m_prob[less]) - 1.0;
+    if (m_prob[more] < 1.0) {
+      large.pop_back();
+      small.push_back(more);
+    }
+  }
+
+  // leftovers differ from 1 only due to rounding errors
+  for (uint32_t i : large) {
+    m_prob[i] = 1.0;
+  }
+  for (uint32_t i : small) {
+    m_prob[i] = 1.0;
+  }
+
+  // cumulative distribution is not needed for sampling
+  std::vector<double>().swap(m_cdf);
+}
+
+uint32_t
+ZipfTable::Sample(double u) const
+{
+  if (m_n == 0) {
+    return 0;
+  }
+
+  if (m_method == ALIAS) {
+    double scaled = u * m_n;
+    uint32_t column = std::min(static_cast<uint32_t>(scaled), m_n - 1);
+    if (scaled - column < m_prob[column]) {
+      return column + 1;
+    }
+    else {
+      return m_alias[column] + 1;
+    }
+  }
+
+  // first rank k with u <= P(rank <= k)
+  auto i = std::lower_bound(m_cdf.begin() + 1, m_cdf.end(), u);
+  if (i == m_cdf.end()) {
+    return 1; // only possible because of rounding errors, matches the old linear search
+  }
+  return static_cast<uint32_t>(i - m_cdf.begin());
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,110 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDNSIM_UTILS_NDN_ZIPF_TABLE_HPP
+#define NDNSIM_UTILS_NDN_ZIPF_TABLE_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include <boost/noncopyable.hpp>
+
+#include <cmath>
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-helpers
+ * @brief Immutable sampling table for Zipf-Mandelbrot distribution
+ *
+ * Probability of rank k (1 <= k <= N) is proportional to 1 / (k + q)^s.  Ranks can be sampled
+ * either with binary search over the cumulative distribution (O(log N) per sample, N doubles), or
+ * with Walker/Vose alias table (O(1) per sample, N doubles and N integers).  Both methods
+ * consume one uniform random value per sample.
+ *
+ * Tables are expensive to build for large N, so they should be obtained with ZipfTable::Get,
+ * which returns the same table for all users with identical parameters for as long as any of
+ * them holds it.
+ */
+class ZipfTable : boost::noncopyable {
+public:
+  enum Method {
+    BINARY_SEARCH,
+    ALIAS
+  };
+
+  /**
+   * @brief Get (build, if not yet cached) table for the given parameters
+   */
+  static shared_ptr<const ZipfTable>
+  Get(uint32_t n, double q, double s, Method method = BINARY_SEARCH);
+
+  ZipfTable(uint32_t n, double q, double s, Method method);
+
+  uint32_t
+  GetN() const
+  {
+    return m_n;
+  }
+
+  Method
+  GetMethod() const
+  {
+    return m_method;
+  }
+
+  /**
+   * @brief Get probability of the rank (1 <= rank <= N)
+   */
+  double
+  GetProbability(uint32_t rank) const
+  {
+    return 1.0 / (std::pow(rank + m_q, m_s) * m_norm);
+  }
+
+  /**
+   * @brief Convert uniform random value @p u in (0, 1] to rank in [1, N]
+   */
+  uint32_t
+  Sample(double u) const;
+
+private:
+  void
+  BuildCdf();
+
+  void
+  BuildAlias();
+
+private:
+  uint32_t m_n;
+  double m_q;
+  double m_s;
+  Method m_method;
+  double m_norm; ///< @brief sum of 1 / (k + q)^s
+
+  std::vector<double> m_cdf;     ///< @brief m_cdf[k] = P(rank <= k), m_cdf[0] = 0
+  std::vector<double> m_prob;    ///< @brief alias table: probability to keep the column
+  std::vector<uint32_t> m_alias; ///< @brief alias table: alternative (0-based) rank
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDNSIM_UTILS_NDN_ZIPF_TABLE_HPP
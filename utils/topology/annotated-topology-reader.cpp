@@ -41,17 +41,30 @@
 #include "ns3/error-model.h"
 #include "ns3/constant-position-mobility-model.h"
 #include "ns3/double.h"
+#include "ns3/data-rate.h"
 
 #include "model/ndn-l3-protocol.hpp"
+#include "helper/ndn-partition-helper.hpp"
 
 #include <boost/foreach.hpp>
 #include <boost/lexical_cast.hpp>
+#include <boost/noncopyable.hpp>
 #include <boost/tokenizer.hpp>
 
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/graphviz.hpp>
 
 #include <set>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #ifdef NS3_MPI
 #include <ns3/mpi-interface.h>
@@ -69,6 +82,7 @@ AnnotatedTopologyReader::AnnotatedTopologyReader(const std::string& path, double
   , m_randY(CreateObject<UniformRandomVariable>())
   , m_scale(scale)
   , m_requiredPartitions(1)
+  , m_nPartitions(1)
 {
   NS_LOG_FUNCTION(this);
 
@@ -93,6 +107,13 @@ AnnotatedTopologyReader::SetBoundingBox(double ulx, double uly, double lrx, doub
   m_randY->SetAttribute("Max", DoubleValue(lry));
 }
 
+void
+AnnotatedTopologyReader::SetPartitions(uint32_t nPartitions)
+{
+  NS_LOG_FUNCTION(this << nPartitions);
+  m_nPartitions = nPartitions;
+}
+
 void
 AnnotatedTopologyReader::SetMobilityModel(const std::string& model)
 {
@@ -150,115 +171,403 @@ AnnotatedTopologyReader::GetLinks() const
   return m_linksList;
 }
 
-NodeContainer
-AnnotatedTopologyReader::Read(void)
+namespace {
+
+/**
+ * \brief Read-only memory mapping of the whole file
+ */
+class MappedFile : boost::noncopyable {
+public:
+  explicit MappedFile(const std::string& fileName)
+    : m_isOpen(false)
+    , m_data(nullptr)
+    , m_size(0)
+  {
+    int fd = ::open(fileName.c_str(), O_RDONLY);
+    if (fd < 0) {
+      return;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) == 0) {
+      m_isOpen = true;
+      m_size = st.st_size;
+      if (m_size > 0) {
+        void* data = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED) {
+          ::madvise(data, m_size, MADV_SEQUENTIAL);
+          m_data = static_cast<const char*>(data);
+        }
+        else {
+          m_isOpen = false;
+          m_size = 0;
+        }
+      }
+    }
+    ::close(fd);
+  }
+
+  ~MappedFile()
+  {
+    if (m_data != nullptr) {
+      ::munmap(const_cast<char*>(m_data), m_size);
+    }
+  }
+
+  bool
+  isOpen() const
+  {
+    return m_isOpen;
+  }
+
+  const char*
+  begin() const
+  {
+    return m_data;
+  }
+
+  const char*
+  end() const
+  {
+    return m_data + m_size;
+  }
+
+private:
+  bool m_isOpen;
+  const char* m_data;
+  size_t m_size;
+};
+
+/**
+ * \brief Splits text into lines and whitespace-separated fields without copying
+ */
+class LineTokenizer {
+public:
+  LineTokenizer(const char* begin, const char* end)
+    : m_pos(begin)
+    , m_end(end)
+    , m_lineBegin(begin)
+    , m_lineEnd(begin)
+    , m_field(begin)
+  {
+  }
+
+  /**
+   * \brief Advance to the next line
+   * \return false if there are no more lines
+   */
+  bool
+  nextLine()
+  {
+    if (m_pos == m_end) {
+      return false;
+    }
+
+    const char* eol = static_cast<const char*>(memchr(m_pos, '\n', m_end - m_pos));
+    m_lineBegin = m_pos;
+    m_lineEnd = (eol != nullptr ? eol : m_end);
+    m_pos = (eol != nullptr ? eol + 1 : m_end);
+
+    if (m_lineEnd != m_lineBegin && *(m_lineEnd - 1) == '\r') {
+      --m_lineEnd;
+    }
+    m_field = m_lineBegin;
+    return true;
+  }
+
+  bool
+  isLine(const char* text) const
+  {
+    size_t length = strlen(text);
+    return static_cast<size_t>(m_lineEnd - m_lineBegin) == length
+           && memcmp(m_lineBegin, text, length) == 0;
+  }
+
+  bool
+  isComment() const
+  {
+    return m_lineBegin != m_lineEnd && *m_lineBegin == '#';
+  }
+
+  /**
+   * \brief Get the next field of the current line (empty string if there are no more fields)
+   */
+  string
+  nextString()
+  {
+    while (m_field != m_lineEnd && isspace(static_cast<unsigned char>(*m_field))) {
+      ++m_field;
+    }
+    const char* begin = m_field;
+    while (m_field != m_lineEnd && !isspace(static_cast<unsigned char>(*m_field))) {
+      ++m_field;
+    }
+    return string(begin, m_field);
+  }
+
+  /**
+   * \brief Get the next field of the current line as a number (0 if missing or malformed)
+   */
+  double
+  nextDouble()
+  {
+    string field = nextString();
+    return strtod(field.c_str(), nullptr);
+  }
+
+private:
+  const char* m_pos;
+  const char* m_end;
+  const char* m_lineBegin;
+  const char* m_lineEnd;
+  const char* m_field;
+};
+
+/**
+ * \brief Sequential reader of values from a binary buffer
+ */
+class BinaryReader {
+public:
+  BinaryReader(const char* begin, const char* end)
+    : m_pos(begin)
+    , m_end(end)
+    , m_isValid(true)
+  {
+  }
+
+  template<typename T>
+  T
+  read()
+  {
+    T value = T();
+    if (static_cast<size_t>(m_end - m_pos) < sizeof(T)) {
+      m_isValid = false;
+      m_pos = m_end;
+      return value;
+    }
+    memcpy(&value, m_pos, sizeof(T));
+    m_pos += sizeof(T);
+    return value;
+  }
+
+  string
+  readString()
+  {
+    uint32_t length = read<uint32_t>();
+    if (static_cast<size_t>(m_end - m_pos) < length) {
+      m_isValid = false;
+      m_pos = m_end;
+      return string();
+    }
+    string value(m_pos, length);
+    m_pos += length;
+    return value;
+  }
+
+  /**
+   * \brief Check that all values so far have been read completely
+   */
+  bool
+  isValid() const
+  {
+    return m_isValid;
+  }
+
+private:
+  const char* m_pos;
+  const char* m_end;
+  bool m_isValid;
+};
+
+template<typename T>
+void
+writeBinary(ostream& os, T value)
 {
-  ifstream topgen;
-  topgen.open(GetFileName().c_str());
+  os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void
+writeBinary(ostream& os, const string& value)
+{
+  writeBinary<uint32_t>(os, value.size());
+  os.write(value.data(), value.size());
+}
+
+const uint32_t BINARY_TOPOLOGY_MAGIC = 0x4e444e54; // "NDNT"
+const uint32_t BINARY_TOPOLOGY_VERSION = 1;
+
+} // namespace
 
-  if (!topgen.is_open() || !topgen.good()) {
+bool
+AnnotatedTopologyReader::ParseFile(vector<NodeRecord>& nodes, vector<LinkRecord>& links) const
+{
+  MappedFile file(GetFileName());
+  if (!file.isOpen()) {
     NS_FATAL_ERROR("Cannot open file " << GetFileName() << " for reading");
-    return m_nodes;
+    return false;
   }
 
-  while (!topgen.eof()) {
-    string line;
-    getline(topgen, line);
+  LineTokenizer tokenizer(file.begin(), file.end());
 
-    if (line == "router")
+  bool hasRouterSection = false;
+  while (tokenizer.nextLine()) {
+    if (tokenizer.isLine("router")) {
+      hasRouterSection = true;
       break;
+    }
   }
 
-  if (topgen.eof()) {
+  if (!hasRouterSection) {
     NS_FATAL_ERROR("Topology file " << GetFileName() << " does not have \"router\" section");
-    return m_nodes;
+    return false;
   }
 
-  while (!topgen.eof()) {
-    string line;
-    getline(topgen, line);
-    if (line[0] == '#')
+  unordered_map<string, uint32_t> index;
+
+  bool hasLinkSection = false;
+  while (tokenizer.nextLine()) {
+    if (tokenizer.isComment())
       continue; // comments
-    if (line == "link")
+    if (tokenizer.isLine("link")) {
+      hasLinkSection = true;
       break; // stop reading nodes
+    }
+
+    NodeRecord record;
+    record.name = tokenizer.nextString();
+    if (record.name.empty())
+      continue;
+
+    tokenizer.nextString(); // city
+    record.latitude = tokenizer.nextDouble();
+    record.longitude = tokenizer.nextDouble();
+    record.systemId = static_cast<uint32_t>(tokenizer.nextDouble());
+
+    index.insert(make_pair(record.name, nodes.size()));
+    nodes.push_back(std::move(record));
+  }
+
+  if (!hasLinkSection) {
+    return false;
+  }
 
-    istringstream lineBuffer(line);
-    string name, city;
-    double latitude = 0, longitude = 0;
-    uint32_t systemId = 0;
+  unordered_set<uint64_t> processedLinks; // to eliminate duplications
+  processedLinks.reserve(2 * nodes.size());
 
-    lineBuffer >> name >> city >> latitude >> longitude >> systemId;
-    if (name.empty())
+  while (tokenizer.nextLine()) {
+    if (tokenizer.isComment())
+      continue; // comments
+
+    string from = tokenizer.nextString();
+    if (from.empty())
       continue;
+    string to = tokenizer.nextString();
+
+    auto fromNode = index.find(from);
+    if (fromNode == index.end()) {
+      NS_FATAL_ERROR(from << " node not found");
+    }
+    auto toNode = index.find(to);
+    if (toNode == index.end()) {
+      NS_FATAL_ERROR(to << " node not found");
+    }
+
+    uint64_t key = (static_cast<uint64_t>(fromNode->second) << 32) | toNode->second;
+    uint64_t reverseKey = (static_cast<uint64_t>(toNode->second) << 32) | fromNode->second;
+    if (processedLinks.count(reverseKey) != 0) {
+      continue; // duplicated link
+    }
+    processedLinks.insert(key);
+
+    LinkRecord record;
+    record.from = fromNode->second;
+    record.to = toNode->second;
+    record.capacity = tokenizer.nextString();
+    record.metric = tokenizer.nextString();
+    record.delay = tokenizer.nextString();
+    record.maxPackets = tokenizer.nextString();
+    record.lossRate = tokenizer.nextString();
+    links.push_back(std::move(record));
+  }
+
+  return true;
+}
+
+NodeContainer
+AnnotatedTopologyReader::Read(void)
+{
+  vector<NodeRecord> nodeRecords;
+  vector<LinkRecord> linkRecords;
+  bool hasLinkSection = ParseFile(nodeRecords, linkRecords);
+
+  if (m_nPartitions > 1) {
+    // systemId of a node cannot be changed after the node is created
+    ndn::PartitionHelper partitioner;
+    for (size_t i = 0; i < nodeRecords.size(); ++i) {
+      partitioner.AddVertex();
+    }
 
+    for (const LinkRecord& record : linkRecords) {
+      // link capacity is the best available estimate of the traffic over the link
+      Time delay = record.delay.empty() ? Seconds(0) : Time(record.delay);
+      double traffic = record.capacity.empty() ? 1.0 : DataRate(record.capacity).GetBitRate();
+      partitioner.AddEdge(record.from, record.to, delay, traffic);
+    }
+
+    vector<uint32_t> partitions = partitioner.Partition(m_nPartitions);
+    for (size_t i = 0; i < nodeRecords.size(); ++i) {
+      nodeRecords[i].systemId = partitions[i];
+    }
+  }
+
+  vector<Ptr<Node>> nodes;
+  nodes.reserve(nodeRecords.size());
+  for (const NodeRecord& record : nodeRecords) {
     Ptr<Node> node;
 
-    if (abs(latitude) > 0.001 && abs(latitude) > 0.001)
-      node = CreateNode(name, m_scale * longitude, -m_scale * latitude, systemId);
+    if (abs(record.latitude) > 0.001 && abs(record.latitude) > 0.001)
+      node = CreateNode(record.name, m_scale * record.longitude, -m_scale * record.latitude,
+                        record.systemId);
     else {
       Ptr<UniformRandomVariable> var = CreateObject<UniformRandomVariable>();
-      node = CreateNode(name, var->GetValue(0, 200), var->GetValue(0, 200), systemId);
+      node = CreateNode(record.name, var->GetValue(0, 200), var->GetValue(0, 200),
+                        record.systemId);
       // node = CreateNode (name, systemId);
     }
+    nodes.push_back(node);
   }
 
-  map<string, set<string>> processedLinks; // to eliminate duplications
-
-  if (topgen.eof()) {
+  if (!hasLinkSection) {
     NS_LOG_ERROR("Topology file " << GetFileName() << " does not have \"link\" section");
     return m_nodes;
   }
 
-  // SeekToSection ("link");
-  while (!topgen.eof()) {
-    string line;
-    getline(topgen, line);
-    if (line == "")
-      continue;
-    if (line[0] == '#')
-      continue; // comments
-
-    // NS_LOG_DEBUG ("Input: [" << line << "]");
-
-    istringstream lineBuffer(line);
-    string from, to, capacity, metric, delay, maxPackets, lossRate;
+  for (const LinkRecord& record : linkRecords) {
+    const string& from = nodeRecords[record.from].name;
+    const string& to = nodeRecords[record.to].name;
 
-    lineBuffer >> from >> to >> capacity >> metric >> delay >> maxPackets >> lossRate;
+    Link link(nodes[record.from], from, nodes[record.to], to);
 
-    if (processedLinks[to].size() != 0
-        && processedLinks[to].find(from) != processedLinks[to].end()) {
-      continue; // duplicated link
-    }
-    processedLinks[from].insert(to);
-
-    Ptr<Node> fromNode = Names::Find<Node>(m_path, from);
-    NS_ASSERT_MSG(fromNode != 0, from << " node not found");
-    Ptr<Node> toNode = Names::Find<Node>(m_path, to);
-    NS_ASSERT_MSG(toNode != 0, to << " node not found");
-
-    Link link(fromNode, from, toNode, to);
+    link.SetAttribute("DataRate", record.capacity);
+    link.SetAttribute("OSPF", record.metric);
 
-    link.SetAttribute("DataRate", capacity);
-    link.SetAttribute("OSPF", metric);
-
-    if (!delay.empty())
-      link.SetAttribute("Delay", delay);
-    if (!maxPackets.empty())
-      link.SetAttribute("MaxPackets", maxPackets);
+    if (!record.delay.empty())
+      link.SetAttribute("Delay", record.delay);
+    if (!record.maxPackets.empty())
+      link.SetAttribute("MaxPackets", record.maxPackets);
 
     // Saran Added lossRate
-    if (!lossRate.empty())
-      link.SetAttribute("LossRate", lossRate);
+    if (!record.lossRate.empty())
+      link.SetAttribute("LossRate", record.lossRate);
 
     AddLink(link);
-    NS_LOG_DEBUG("New link " << from << " <==> " << to << " / " << capacity << " with " << metric
-                             << " metric (" << delay << ", " << maxPackets << ", " << lossRate
-                             << ")");
+    NS_LOG_DEBUG("New link " << from << " <==> " << to << " / " << record.capacity << " with "
+                             << record.metric << " metric (" << record.delay << ", "
+                             << record.maxPackets << ", " << record.lossRate << ")");
   }
 
   NS_LOG_INFO("Annotated topology created with " << m_nodes.GetN() << " nodes and " << LinksSize()
                                                  << " links");
-  topgen.close();
 
   ApplySettings();
 
@@ -278,48 +587,39 @@ AnnotatedTopologyReader::AssignIpv4Addresses(Ipv4Address base)
   }
 }
 
+namespace {
+
 void
-AnnotatedTopologyReader::ApplyOspfMetric()
+applyOspfMetric(Ptr<Node> node, Ptr<NetDevice> netDevice, uint16_t metric)
 {
-  BOOST_FOREACH (const Link& link, m_linksList) {
-    NS_LOG_DEBUG("OSPF: " << link.GetAttribute("OSPF"));
-    uint16_t metric = boost::lexical_cast<uint16_t>(link.GetAttribute("OSPF"));
-
-    {
-      Ptr<Ipv4> ipv4 = link.GetFromNode()->GetObject<Ipv4>();
-      if (ipv4 != 0) {
-        int32_t interfaceId = ipv4->GetInterfaceForDevice(link.GetFromNetDevice());
-        NS_ASSERT(interfaceId >= 0);
-
-        ipv4->SetMetric(interfaceId, metric);
-      }
+  Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
+  if (ipv4 != 0) {
+    int32_t interfaceId = ipv4->GetInterfaceForDevice(netDevice);
+    NS_ASSERT(interfaceId >= 0);
 
-      Ptr<ndn::L3Protocol> ndn = link.GetFromNode()->GetObject<ndn::L3Protocol>();
-      if (ndn != 0) {
-        shared_ptr<ndn::Face> face = ndn->getFaceByNetDevice(link.GetFromNetDevice());
-        NS_ASSERT(face != 0);
+    ipv4->SetMetric(interfaceId, metric);
+  }
 
-        face->setMetric(metric);
-      }
-    }
+  Ptr<ndn::L3Protocol> ndn = node->GetObject<ndn::L3Protocol>();
+  if (ndn != 0) {
+    shared_ptr<ndn::Face> face = ndn->getFaceByNetDevice(netDevice);
+    NS_ASSERT(face != 0);
 
-    {
-      Ptr<Ipv4> ipv4 = link.GetToNode()->GetObject<Ipv4>();
-      if (ipv4 != 0) {
-        int32_t interfaceId = ipv4->GetInterfaceForDevice(link.GetToNetDevice());
-        NS_ASSERT(interfaceId >= 0);
+    face->setMetric(metric);
+  }
+}
 
-        ipv4->SetMetric(interfaceId, metric);
-      }
+} // namespace
 
-      Ptr<ndn::L3Protocol> ndn = link.GetToNode()->GetObject<ndn::L3Protocol>();
-      if (ndn != 0) {
-        shared_ptr<ndn::Face> face = ndn->getFaceByNetDevice(link.GetToNetDevice());
-        NS_ASSERT(face != 0);
+void
+AnnotatedTopologyReader::ApplyOspfMetric()
+{
+  BOOST_FOREACH (const Link& link, m_linksList) {
+    NS_LOG_DEBUG("OSPF: " << link.GetAttribute("OSPF"));
+    uint16_t metric = boost::lexical_cast<uint16_t>(link.GetAttribute("OSPF"));
 
-        face->setMetric(metric);
-      }
-    }
+    applyOspfMetric(link.GetFromNode(), link.GetFromNetDevice(), metric);
+    applyOspfMetric(link.GetToNode(), link.GetToNetDevice(), metric);
   }
 }
 
@@ -573,4 +873,134 @@ AnnotatedTopologyReader::SaveGraphviz(const std::string& file)
   write_graphviz(of, graph, make_name_writer(names));
 }
 
+void
+AnnotatedTopologyReader::GetNodeRoles(std::vector<uint8_t>& roles) const
+{
+  roles.assign(m_nodes.GetN(), 0);
+}
+
+void
+AnnotatedTopologyReader::SetNodeRoles(const std::vector<uint8_t>& roles)
+{
+}
+
+void
+AnnotatedTopologyReader::SaveBinaryTopology(const std::string& file)
+{
+  ofstream os(file.c_str(), ios::binary | ios::trunc);
+  if (!os.is_open()) {
+    NS_LOG_ERROR("File " << file << " cannot be opened for writing");
+    return;
+  }
+
+  vector<uint8_t> roles;
+  GetNodeRoles(roles);
+
+  writeBinary(os, BINARY_TOPOLOGY_MAGIC);
+  writeBinary(os, BINARY_TOPOLOGY_VERSION);
+  writeBinary<uint32_t>(os, m_nodes.GetN());
+  writeBinary<uint32_t>(os, m_linksList.size());
+
+  unordered_map<uint32_t, uint32_t> index; // node ID => index in the snapshot
+  for (uint32_t i = 0; i < m_nodes.GetN(); ++i) {
+    Ptr<Node> node = m_nodes.Get(i);
+    index[node->GetId()] = i;
+
+    Ptr<MobilityModel> mobility = node->GetObject<MobilityModel>();
+    Vector position = mobility != 0 ? mobility->GetPosition() : Vector();
+
+    writeBinary(os, Names::FindName(node));
+    writeBinary<uint32_t>(os, node->GetSystemId());
+    writeBinary<uint8_t>(os, roles[i]);
+    writeBinary<uint8_t>(os, mobility != 0);
+    writeBinary<double>(os, position.x);
+    writeBinary<double>(os, position.y);
+  }
+
+  for (Link& link : m_linksList) {
+    writeBinary<uint32_t>(os, index.at(link.GetFromNode()->GetId()));
+    writeBinary<uint32_t>(os, index.at(link.GetToNode()->GetId()));
+    writeBinary<uint32_t>(os, distance(link.AttributesBegin(), link.AttributesEnd()));
+    for (auto attribute = link.AttributesBegin(); attribute != link.AttributesEnd(); attribute++) {
+      writeBinary(os, attribute->first);
+      writeBinary(os, attribute->second);
+    }
+  }
+}
+
+NodeContainer
+AnnotatedTopologyReader::ReadBinaryTopology(const std::string& file)
+{
+  MappedFile mapped(file);
+  if (!mapped.isOpen()) {
+    NS_FATAL_ERROR("Cannot open file " << file << " for reading");
+    return m_nodes;
+  }
+
+  BinaryReader reader(mapped.begin(), mapped.end());
+  if (reader.read<uint32_t>() != BINARY_TOPOLOGY_MAGIC
+      || reader.read<uint32_t>() != BINARY_TOPOLOGY_VERSION) {
+    NS_FATAL_ERROR("File " << file << " is not a binary topology snapshot of supported version");
+    return m_nodes;
+  }
+
+  uint32_t nNodes = reader.read<uint32_t>();
+  uint32_t nLinks = reader.read<uint32_t>();
+
+  vector<Ptr<Node>> nodes;
+  vector<string> names;
+  vector<uint8_t> roles;
+  nodes.reserve(nNodes);
+  names.reserve(nNodes);
+  roles.reserve(nNodes);
+  for (uint32_t i = 0; i < nNodes && reader.isValid(); ++i) {
+    string name = reader.readString();
+    uint32_t systemId = reader.read<uint32_t>();
+    uint8_t role = reader.read<uint8_t>();
+    bool hasPosition = reader.read<uint8_t>() != 0;
+    double x = reader.read<double>();
+    double y = reader.read<double>();
+    if (!reader.isValid()) {
+      break;
+    }
+
+    if (hasPosition)
+      nodes.push_back(CreateNode(name, x, y, systemId));
+    else
+      nodes.push_back(CreateNode(name, systemId));
+    names.push_back(name);
+    roles.push_back(role);
+  }
+
+  for (uint32_t i = 0; i < nLinks && reader.isValid(); ++i) {
+    uint32_t from = reader.read<uint32_t>();
+    uint32_t to = reader.read<uint32_t>();
+    uint32_t nAttributes = reader.read<uint32_t>();
+    if (!reader.isValid() || from >= nodes.size() || to >= nodes.size()) {
+      NS_FATAL_ERROR("Binary topology snapshot " << file << " is corrupted");
+    }
+
+    Link link(nodes[from], names[from], nodes[to], names[to]);
+    for (uint32_t j = 0; j < nAttributes && reader.isValid(); ++j) {
+      string attribute = reader.readString();
+      string value = reader.readString();
+      link.SetAttribute(attribute, value);
+    }
+    AddLink(link);
+  }
+
+  if (!reader.isValid()) {
+    NS_FATAL_ERROR("Binary topology snapshot " << file << " is truncated");
+  }
+
+  SetNodeRoles(roles);
+
+  NS_LOG_INFO("Topology snapshot loaded with " << m_nodes.GetN() << " nodes and " << LinksSize()
+                                               << " links");
+
+  ApplySettings();
+
+  return m_nodes;
+}
+
 }
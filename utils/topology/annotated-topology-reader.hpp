@@ -26,6 +26,9 @@
 #include "ns3/random-variable-stream.h"
 #include "ns3/object-factory.h"
 
+#include <string>
+#include <vector>
+
 namespace ns3 {
 
 /**
@@ -97,8 +100,23 @@ public:
   virtual void
   SetMobilityModel(const std::string& model);
 
+  /**
+   * \brief Automatically assign nodes to @p nPartitions partitions (systemIds) for distributed
+   *        simulation, overriding systemIds specified in the topology file
+   *
+   * Nodes are split into balanced partitions, avoiding to cut links with high capacity and low
+   * delay (see ndn::PartitionHelper).  Should be called before Read().
+   *
+   * Example: reader.SetPartitions(ndn::PartitionHelper::GetNPartitions());
+   */
+  virtual void
+  SetPartitions(uint32_t nPartitions);
+
   /**
    * \brief Apply OSPF metric on Ipv4 (if exists) and Ccnx (if exists) stacks
+   *
+   * The OSPF attribute of each link is parsed on every call and applied to both ends of the
+   * link
    */
   virtual void
   ApplyOspfMetric();
@@ -115,6 +133,35 @@ public:
   virtual void
   SaveGraphviz(const std::string& file);
 
+  /**
+   * \brief Save the topology (as created by Read) into a binary snapshot
+   *
+   * The snapshot contains nodes with their roles, positions, and systemIds, and links with all
+   * their attributes, i.e., the result of all preprocessing done by Read.  The format depends on
+   * the host architecture and is intended only as a cache for repeated runs:
+   *
+   *     if (boost::filesystem::exists(cache)) {
+   *       reader.ReadBinaryTopology(cache);
+   *     }
+   *     else {
+   *       reader.Read();
+   *       reader.SaveBinaryTopology(cache);
+   *     }
+   */
+  virtual void
+  SaveBinaryTopology(const std::string& file);
+
+  /**
+   * \brief Create nodes and links from the binary snapshot saved by SaveBinaryTopology
+   *
+   * Used instead of Read, skipping parsing and preprocessing of the topology.
+   * SetPartitions has no effect, systemIds are taken from the snapshot.
+   *
+   * \return the container of the nodes created
+   */
+  virtual NodeContainer
+  ReadBinaryTopology(const std::string& file);
+
 protected:
   Ptr<Node>
   CreateNode(const std::string name, uint32_t systemId);
@@ -122,6 +169,58 @@ protected:
   Ptr<Node>
   CreateNode(const std::string name, double posX, double posY, uint32_t systemId);
 
+protected:
+  /**
+   * \brief Node as specified in the "router" section of the topology file
+   */
+  struct NodeRecord {
+    std::string name;
+    double latitude;
+    double longitude;
+    uint32_t systemId;
+  };
+
+  /**
+   * \brief Link as specified in the "link" section of the topology file
+   */
+  struct LinkRecord {
+    uint32_t from; ///< \brief index of the node record
+    uint32_t to;   ///< \brief index of the node record
+    std::string capacity;
+    std::string metric;
+    std::string delay;
+    std::string maxPackets;
+    std::string lossRate;
+  };
+
+  /**
+   * \brief Parse topology file into node and link records without creating any objects
+   *
+   * The file is memory-mapped and tokenized in a single pass.  Link endpoints are resolved
+   * through a hash index of node names, and duplicate links (the same link specified in the
+   * reverse direction) are dropped using a hash set of node index pairs.
+   *
+   * \return false if the file does not have "link" section
+   */
+  bool
+  ParseFile(std::vector<NodeRecord>& nodes, std::vector<LinkRecord>& links) const;
+
+  /**
+   * \brief Get reader-specific roles of the nodes (in order of m_nodes) to be saved in the
+   *        binary snapshot
+   *
+   * All roles are 0 by default
+   */
+  virtual void
+  GetNodeRoles(std::vector<uint8_t>& roles) const;
+
+  /**
+   * \brief Restore reader-specific state from the roles of the nodes (in order of m_nodes)
+   *        after the binary snapshot is loaded
+   */
+  virtual void
+  SetNodeRoles(const std::vector<uint8_t>& roles);
+
 protected:
   /**
    * \brief This method applies setting to corresponding nodes and links
@@ -147,6 +246,9 @@ private:
   double m_scale;
 
   uint32_t m_requiredPartitions;
+
+protected:
+  uint32_t m_nPartitions;
 };
 }
 
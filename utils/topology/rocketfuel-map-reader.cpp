@@ -40,9 +40,12 @@
 #include "ns3/uinteger.h"
 #include "ns3/ipv4-address.h"
 #include "ns3/node-list.h"
+#include "ns3/data-rate.h"
 
 #include "ns3/mobility-model.h"
 
+#include "helper/ndn-partition-helper.hpp"
+
 #include <regex.h>
 
 #include <boost/foreach.hpp>
@@ -52,6 +55,7 @@
 #include <boost/graph/connected_components.hpp>
 
 #include <iomanip>
+#include <unordered_map>
 
 using namespace std;
 using namespace boost;
@@ -396,9 +400,44 @@ RocketfuelMapReader::Read(RocketfuelParams params, bool keepOneComponent /*=true
     NS_LOG_DEBUG("After 2 eliminating disconnected nodes:  " << num_vertices(m_graph));
   }
 
+  map<Traits::vertex_descriptor, uint32_t> systemIds;
+  if (m_nPartitions > 1) {
+    ndn::PartitionHelper partitioner;
+    map<Traits::vertex_descriptor, uint32_t> indices;
+    for (tie(v, endv) = vertices(m_graph); v != endv; v++) {
+      indices[*v] = partitioner.AddVertex();
+    }
+
+    // links are not created yet, use the mean of their delay and bandwidth ranges
+    for (tie(e, ende) = edges(m_graph); e != ende; e++) {
+      Traits::vertex_descriptor u = source(*e, m_graph), v = target(*e, m_graph);
+      node_type_t u_type = get(vertex_rank, m_graph, u), v_type = get(vertex_rank, m_graph, v);
+
+      string minBw = params.minb2gBandwidth, maxBw = params.maxb2gBandwidth;
+      string minDelay = params.minb2gDelay, maxDelay = params.maxb2gDelay;
+      if (u_type == BACKBONE && v_type == BACKBONE) {
+        minBw = params.minb2bBandwidth, maxBw = params.maxb2bBandwidth;
+        minDelay = params.minb2bDelay, maxDelay = params.maxb2bDelay;
+      }
+      else if (u_type == CLIENT || v_type == CLIENT) {
+        minBw = params.ming2cBandwidth, maxBw = params.maxg2cBandwidth;
+        minDelay = params.ming2cDelay, maxDelay = params.maxg2cDelay;
+      }
+
+      Time delay = Seconds((Time(minDelay).GetSeconds() + Time(maxDelay).GetSeconds()) / 2);
+      double traffic = (DataRate(minBw).GetBitRate() + DataRate(maxBw).GetBitRate()) / 2.0;
+      partitioner.AddEdge(indices[u], indices[v], delay, traffic);
+    }
+
+    vector<uint32_t> partitions = partitioner.Partition(m_nPartitions);
+    for (const auto& index : indices) {
+      systemIds[index.first] = partitions[index.second];
+    }
+  }
+
   for (tie(v, endv) = vertices(m_graph); v != endv; v++) {
     string nodeName = get(vertex_name, m_graph, *v);
-    Ptr<Node> node = CreateNode(nodeName, 0);
+    Ptr<Node> node = CreateNode(nodeName, systemIds.empty() ? 0 : systemIds[*v]);
 
     node_type_t type = get(vertex_rank, m_graph, *v);
     switch (type) {
@@ -492,6 +531,69 @@ nodeWriter(std::ostream& os, NodeContainer& m)
   }
 };
 
+void
+RocketfuelMapReader::GetNodeRoles(std::vector<uint8_t>& roles) const
+{
+  std::unordered_map<uint32_t, node_type_t> types;
+  for (NodeContainer::Iterator node = m_backboneRouters.Begin(); node != m_backboneRouters.End();
+       node++) {
+    types[(*node)->GetId()] = BACKBONE;
+  }
+  for (NodeContainer::Iterator node = m_gatewayRouters.Begin(); node != m_gatewayRouters.End();
+       node++) {
+    types[(*node)->GetId()] = GATEWAY;
+  }
+  for (NodeContainer::Iterator node = m_customerRouters.Begin(); node != m_customerRouters.End();
+       node++) {
+    types[(*node)->GetId()] = CLIENT;
+  }
+
+  roles.assign(m_nodes.GetN(), UNKNOWN);
+  for (uint32_t i = 0; i < m_nodes.GetN(); ++i) {
+    auto type = types.find(m_nodes.Get(i)->GetId());
+    if (type != types.end()) {
+      roles[i] = type->second;
+    }
+  }
+}
+
+void
+RocketfuelMapReader::SetNodeRoles(const std::vector<uint8_t>& roles)
+{
+  std::unordered_map<uint32_t, Traits::vertex_descriptor> vertices;
+  for (uint32_t i = 0; i < m_nodes.GetN(); ++i) {
+    Ptr<Node> node = m_nodes.Get(i);
+    string name = Names::FindName(node);
+
+    Traits::vertex_descriptor vertex = add_vertex(nodeProperty(name), m_graph);
+    put(vertex_index, m_graph, vertex, i);
+    put(vertex_rank, m_graph, vertex, static_cast<node_type_t>(roles[i]));
+    vertices[node->GetId()] = vertex;
+
+    switch (roles[i]) {
+    case BACKBONE:
+      put(vertex_color, m_graph, vertex, "blue");
+      m_backboneRouters.Add(node);
+      break;
+    case CLIENT:
+      put(vertex_color, m_graph, vertex, "red");
+      m_customerRouters.Add(node);
+      break;
+    case GATEWAY:
+      put(vertex_color, m_graph, vertex, "green");
+      m_gatewayRouters.Add(node);
+      break;
+    default:
+      NS_FATAL_ERROR("Unknown type of node " << name << " in the topology snapshot");
+      break;
+    }
+  }
+
+  for (const Link& link : m_linksList) {
+    add_edge(vertices[link.GetFromNode()->GetId()], vertices[link.GetToNode()->GetId()], m_graph);
+  }
+}
+
 void
 RocketfuelMapReader::SaveTopology(const std::string& file)
 {
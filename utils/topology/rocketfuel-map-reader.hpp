@@ -124,6 +124,19 @@ public:
   virtual void
   SaveGraphviz(const std::string& file);
 
+protected:
+  /**
+   * @brief Roles are backbone, gateway, and customer router types
+   */
+  virtual void
+  GetNodeRoles(std::vector<uint8_t>& roles) const;
+
+  /**
+   * @brief Restore router type containers and the graph from the binary snapshot
+   */
+  virtual void
+  SetNodeRoles(const std::vector<uint8_t>& roles);
+
 private:
   RocketfuelMapReader(const RocketfuelMapReader&);
   RocketfuelMapReader&
@@ -0,0 +1,341 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "topology-generator.hpp"
+
+#include "ns3/log.h"
+#include "ns3/assert.h"
+#include "ns3/double.h"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+NS_LOG_COMPONENT_DEFINE("TopologyGenerator");
+
+namespace ns3 {
+
+TopologyGenerator::TopologyGenerator(const std::string& path, double scale /*=1.0*/)
+  : AnnotatedTopologyReader(path, scale)
+  , m_rand(CreateObject<UniformRandomVariable>())
+  , m_spacing(scale)
+  , m_namePrefix("node-")
+  , m_metric("1")
+{
+}
+
+TopologyGenerator::~TopologyGenerator()
+{
+}
+
+void
+TopologyGenerator::SetLinkAttributes(const std::string& dataRate, const std::string& delay,
+                                     const std::string& metric)
+{
+  m_dataRate = dataRate;
+  m_delay = delay;
+  m_metric = metric;
+}
+
+void
+TopologyGenerator::SetNamePrefix(const std::string& prefix)
+{
+  m_namePrefix = prefix;
+}
+
+void
+TopologyGenerator::Reserve(uint32_t n)
+{
+  NS_ASSERT_MSG(m_nodes.GetN() == 0, "TopologyGenerator can create only one topology");
+
+  m_created.reserve(n);
+  m_names.reserve(n);
+}
+
+uint32_t
+TopologyGenerator::AddNode(double x, double y)
+{
+  std::string name = m_namePrefix + std::to_string(m_created.size());
+  m_created.push_back(CreateNode(name, x, y, 0));
+  m_names.push_back(std::move(name));
+  return m_created.size() - 1;
+}
+
+void
+TopologyGenerator::Connect(uint32_t from, uint32_t to)
+{
+  Link link(m_created[from], m_names[from], m_created[to], m_names[to]);
+
+  if (!m_dataRate.empty())
+    link.SetAttribute("DataRate", m_dataRate);
+  if (!m_delay.empty())
+    link.SetAttribute("Delay", m_delay);
+  link.SetAttribute("OSPF", m_metric);
+
+  AddLink(link);
+}
+
+NodeContainer
+TopologyGenerator::Finish()
+{
+  NS_LOG_INFO("Topology generated with " << m_nodes.GetN() << " nodes and " << LinksSize()
+                                         << " links");
+
+  m_created.clear();
+  m_names.clear();
+
+  ApplySettings();
+
+  return m_nodes;
+}
+
+NodeContainer
+TopologyGenerator::CreateChain(uint32_t n)
+{
+  Reserve(n);
+
+  for (uint32_t i = 0; i < n; ++i) {
+    AddNode(i * m_spacing, 0);
+    if (i > 0) {
+      Connect(i - 1, i);
+    }
+  }
+
+  return Finish();
+}
+
+NodeContainer
+TopologyGenerator::CreateGrid(uint32_t rows, uint32_t columns)
+{
+  Reserve(rows * columns);
+
+  for (uint32_t row = 0; row < rows; ++row) {
+    for (uint32_t column = 0; column < columns; ++column) {
+      AddNode(column * m_spacing, row * m_spacing);
+    }
+  }
+
+  for (uint32_t row = 0; row < rows; ++row) {
+    for (uint32_t column = 0; column < columns; ++column) {
+      if (column + 1 < columns) {
+        Connect(row * columns + column, row * columns + column + 1);
+      }
+      if (row + 1 < rows) {
+        Connect(row * columns + column, (row + 1) * columns + column);
+      }
+    }
+  }
+
+  return Finish();
+}
+
+NodeContainer
+TopologyGenerator::CreateTree(uint32_t fanout, uint32_t depth)
+{
+  NS_ASSERT(fanout > 0);
+
+  // leaves are spread over the width of the lowest level
+  double width = std::pow(fanout, depth);
+  uint32_t levelSize = 1;
+  uint32_t total = 0;
+  for (uint32_t level = 0; level <= depth; ++level) {
+    total += levelSize;
+    levelSize *= fanout;
+  }
+  Reserve(total);
+
+  levelSize = 1;
+  for (uint32_t level = 0; level <= depth; ++level) {
+    for (uint32_t i = 0; i < levelSize; ++i) {
+      uint32_t node = AddNode((i + 0.5) * width / levelSize * m_spacing, level * m_spacing);
+      if (node > 0) {
+        Connect((node - 1) / fanout, node);
+      }
+    }
+    levelSize *= fanout;
+  }
+
+  return Finish();
+}
+
+NodeContainer
+TopologyGenerator::CreateFatTree(uint32_t k)
+{
+  NS_ASSERT_MSG(k >= 2 && k % 2 == 0, "Number of ports of fat-tree switches should be even");
+
+  uint32_t half = k / 2;
+  uint32_t nCores = half * half;
+  uint32_t nHosts = k * half * half;
+  Reserve(nCores + k * k + nHosts);
+
+  // hosts are spread over the bottom level, switches above them
+  double width = nHosts;
+
+  for (uint32_t i = 0; i < nCores; ++i) {
+    AddNode((i + 0.5) * width / nCores * m_spacing, 0);
+  }
+
+  std::vector<uint32_t> edges;
+  edges.reserve(k * half);
+  for (uint32_t pod = 0; pod < k; ++pod) {
+    uint32_t firstAggregation = m_created.size();
+    for (uint32_t i = 0; i < half; ++i) {
+      uint32_t aggregation = AddNode((pod * half + i + 0.5) * width / (k * half) * m_spacing,
+                                     m_spacing);
+      // i-th aggregation switch of each pod is connected to the i-th group of core switches
+      for (uint32_t j = 0; j < half; ++j) {
+        Connect(i * half + j, aggregation);
+      }
+    }
+
+    for (uint32_t i = 0; i < half; ++i) {
+      uint32_t edge = AddNode((pod * half + i + 0.5) * width / (k * half) * m_spacing,
+                              2 * m_spacing);
+      for (uint32_t j = 0; j < half; ++j) {
+        Connect(firstAggregation + j, edge);
+      }
+      edges.push_back(edge);
+    }
+  }
+
+  for (uint32_t i = 0; i < edges.size(); ++i) {
+    for (uint32_t j = 0; j < half; ++j) {
+      uint32_t host = AddNode((i * half + j + 0.5) * m_spacing, 3 * m_spacing);
+      Connect(edges[i], host);
+    }
+  }
+
+  return Finish();
+}
+
+NodeContainer
+TopologyGenerator::CreateBarabasiAlbert(uint32_t n, uint32_t m)
+{
+  NS_ASSERT_MSG(m > 0 && n > m, "Barabasi-Albert graph requires 0 < m < n");
+  Reserve(n);
+
+  double size = 1000 * m_spacing;
+
+  // each node appears once per incident link, so uniform sampling of the list is proportional
+  // to node degrees
+  std::vector<uint32_t> endpoints;
+  endpoints.reserve(2 * (m * (m + 1) / 2 + (n - m - 1) * m));
+
+  for (uint32_t i = 0; i <= m; ++i) {
+    AddNode(m_rand->GetValue(0, size), m_rand->GetValue(0, size));
+    for (uint32_t j = 0; j < i; ++j) {
+      Connect(j, i);
+      endpoints.push_back(j);
+      endpoints.push_back(i);
+    }
+  }
+
+  std::vector<uint32_t> targets;
+  targets.reserve(m);
+  for (uint32_t i = m + 1; i < n; ++i) {
+    uint32_t node = AddNode(m_rand->GetValue(0, size), m_rand->GetValue(0, size));
+
+    targets.clear();
+    while (targets.size() < m) {
+      uint32_t target = endpoints[m_rand->GetInteger(0, endpoints.size() - 1)];
+      if (std::find(targets.begin(), targets.end(), target) == targets.end()) {
+        targets.push_back(target);
+      }
+    }
+
+    for (uint32_t target : targets) {
+      Connect(target, node);
+      endpoints.push_back(target);
+      endpoints.push_back(node);
+    }
+  }
+
+  return Finish();
+}
+
+NodeContainer
+TopologyGenerator::CreateWaxman(uint32_t n, double alpha, double beta)
+{
+  NS_ASSERT_MSG(alpha > 0 && alpha <= 1 && beta > 0,
+                "Waxman graph requires 0 < alpha <= 1 and beta > 0");
+  Reserve(n);
+
+  const double MIN_PROBABILITY = 1e-6;
+
+  // coordinates in the unit square
+  std::vector<double> x(n), y(n);
+  for (uint32_t i = 0; i < n; ++i) {
+    x[i] = m_rand->GetValue(0, 1);
+    y[i] = m_rand->GetValue(0, 1);
+    AddNode(x[i] * 1000 * m_spacing, y[i] * 1000 * m_spacing);
+  }
+
+  // only pairs closer than maxDistance can be connected with non-negligible probability, so
+  // nodes are bucketed into cells of that size and only neighboring cells are compared
+  double scale = beta * std::sqrt(2.0);
+  double maxDistance = std::min(std::sqrt(2.0), scale * std::log(alpha / MIN_PROBABILITY));
+  if (maxDistance <= 0) {
+    return Finish();
+  }
+  uint32_t nCells = std::max(1.0, std::floor(std::min(1 / maxDistance, std::sqrt(n) + 1.0)));
+
+  std::vector<std::vector<uint32_t>> cells(nCells * nCells);
+  for (uint32_t i = 0; i < n; ++i) {
+    uint32_t column = std::min(static_cast<uint32_t>(x[i] * nCells), nCells - 1);
+    uint32_t row = std::min(static_cast<uint32_t>(y[i] * nCells), nCells - 1);
+    cells[row * nCells + column].push_back(i);
+  }
+
+  for (uint32_t row = 0; row < nCells; ++row) {
+    for (uint32_t column = 0; column < nCells; ++column) {
+      const std::vector<uint32_t>& cell = cells[row * nCells + column];
+
+      // the cell itself and half of its neighbors, so that each pair is considered once
+      const int offsets[5][2] = {{0, 0}, {0, 1}, {1, -1}, {1, 0}, {1, 1}};
+      for (const auto& offset : offsets) {
+        int otherRow = static_cast<int>(row) + offset[0];
+        int otherColumn = static_cast<int>(column) + offset[1];
+        if (otherRow >= static_cast<int>(nCells) || otherColumn < 0
+            || otherColumn >= static_cast<int>(nCells)) {
+          continue;
+        }
+        const std::vector<uint32_t>& other = cells[otherRow * nCells + otherColumn];
+        bool isSame = (&other == &cell);
+
+        for (uint32_t i = 0; i < cell.size(); ++i) {
+          for (uint32_t j = (isSame ? i + 1 : 0); j < other.size(); ++j) {
+            uint32_t u = cell[i];
+            uint32_t v = other[j];
+            double distance = std::hypot(x[u] - x[v], y[u] - y[v]);
+            if (distance > maxDistance) {
+              continue;
+            }
+            if (m_rand->GetValue(0, 1) < alpha * std::exp(-distance / scale)) {
+              Connect(std::min(u, v), std::max(u, v));
+            }
+          }
+        }
+      }
+    }
+  }
+
+  return Finish();
+}
+
+} // namespace ns3
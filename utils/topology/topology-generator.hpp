@@ -0,0 +1,157 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef TOPOLOGY_GENERATOR_H
+#define TOPOLOGY_GENERATOR_H
+
+#include "ns3/ndnSIM/utils/topology/annotated-topology-reader.hpp"
+
+#include <string>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * \brief Generator of synthetic topologies (chains, grids, trees, fat-trees, Barabasi-Albert and
+ *        Waxman random graphs)
+ *
+ * Topologies are generated directly in memory, producing the same nodes and links as
+ * AnnotatedTopologyReader::Read would for the equivalent topology file: nodes are named
+ * <prefix><index>, have positions (mobility model), and links carry DataRate, Delay, and OSPF
+ * attributes.  Therefore, ApplyOspfMetric, SaveTopology, SaveBinaryTopology, etc. can be used
+ * as with the reader.
+ *
+ * Each generator object creates a single topology:
+ *
+ *     TopologyGenerator generator;
+ *     generator.SetLinkAttributes("10Mbps", "5ms");
+ *     NodeContainer nodes = generator.CreateGrid(100, 100);
+ */
+class TopologyGenerator : public AnnotatedTopologyReader {
+public:
+  /**
+   * \param path ns3::Names path
+   * \param scale distance between neighbor nodes in regular topologies, size of the square
+   *        area (divided by 1000) for random graphs
+   */
+  TopologyGenerator(const std::string& path = "", double scale = 1.0);
+  virtual ~TopologyGenerator();
+
+  /**
+   * \brief Set attributes of the generated links
+   *
+   * Empty DataRate or Delay means that defaults of PointToPointNetDevice and
+   * PointToPointChannel are used
+   */
+  void
+  SetLinkAttributes(const std::string& dataRate, const std::string& delay,
+                    const std::string& metric = "1");
+
+  /**
+   * \brief Set prefix of node names (default "node-")
+   */
+  void
+  SetNamePrefix(const std::string& prefix);
+
+  /**
+   * \brief Chain of @p n nodes
+   */
+  NodeContainer
+  CreateChain(uint32_t n);
+
+  /**
+   * \brief Grid of @p rows x @p columns nodes (node index is row * columns + column)
+   */
+  NodeContainer
+  CreateGrid(uint32_t rows, uint32_t columns);
+
+  /**
+   * \brief Complete tree with @p depth levels below the root, each inner node having @p fanout
+   *        children (children of node i are fanout * i + 1 .. fanout * i + fanout)
+   */
+  NodeContainer
+  CreateTree(uint32_t fanout, uint32_t depth);
+
+  /**
+   * \brief k-ary fat-tree with (k/2)^2 core, k^2 / 2 aggregation, k^2 / 2 edge switches, and
+   *        k^3 / 4 hosts
+   *
+   * Nodes are ordered as core switches, then aggregation and edge switches of each pod, then
+   * hosts.
+   *
+   * \param k number of ports of each switch (even)
+   */
+  NodeContainer
+  CreateFatTree(uint32_t k);
+
+  /**
+   * \brief Barabasi-Albert scale-free random graph
+   *
+   * Starts from a clique of m + 1 nodes, then each new node is attached to @p m distinct
+   * existing nodes chosen with probability proportional to their degree.
+   */
+  NodeContainer
+  CreateBarabasiAlbert(uint32_t n, uint32_t m);
+
+  /**
+   * \brief Waxman random graph
+   *
+   * Nodes are placed uniformly in a square, and each pair of nodes at distance d is connected
+   * with probability alpha * exp(-d / (beta * L)), where L is the diagonal of the square.  Pairs
+   * for which the probability is below 10^-6 are not considered, which makes generation close to
+   * linear in the number of nodes for small @p beta.  The graph is not necessarily connected.
+   */
+  NodeContainer
+  CreateWaxman(uint32_t n, double alpha, double beta);
+
+private:
+  /**
+   * \brief Start new topology of @p n nodes
+   */
+  void
+  Reserve(uint32_t n);
+
+  uint32_t
+  AddNode(double x, double y);
+
+  void
+  Connect(uint32_t from, uint32_t to);
+
+  /**
+   * \brief Create network devices for the generated links
+   */
+  NodeContainer
+  Finish();
+
+private:
+  Ptr<UniformRandomVariable> m_rand;
+  double m_spacing;
+
+  std::string m_namePrefix;
+  std::string m_dataRate;
+  std::string m_delay;
+  std::string m_metric;
+
+  std::vector<Ptr<Node>> m_created;
+  std::vector<std::string> m_names;
+};
+
+} // namespace ns3
+
+#endif // TOPOLOGY_GENERATOR_H
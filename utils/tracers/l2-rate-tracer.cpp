@@ -25,6 +25,7 @@
 #include "ns3/callback.h"
 #include "ns3/simulator.h"
 #include "ns3/node-list.h"
+#include "helper/ndn-partition-helper.hpp"
 #include "ns3/node.h"
 #include "ns3/log.h"
 
@@ -51,7 +52,8 @@ L2RateTracer::InstallAll(const std::string& file, Time averagingPeriod /* = Seco
   std::shared_ptr<std::ostream> outputStream;
   if (file != "-") {
     std::shared_ptr<std::ofstream> os(new std::ofstream());
-    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
+    os->open(ndn::PartitionHelper::GetLocalFileName(file).c_str(),
+             std::ios_base::out | std::ios_base::trunc);
 
     if (!os->is_open()) {
       NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
@@ -65,6 +67,9 @@ L2RateTracer::InstallAll(const std::string& file, Time averagingPeriod /* = Seco
   }
 
   for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+    if (!ndn::PartitionHelper::IsLocal(*node)) {
+      continue;
+    }
     NS_LOG_DEBUG("Node: " << boost::lexical_cast<std::string>((*node)->GetId()));
 
     Ptr<L2RateTracer> trace = Create<L2RateTracer>(outputStream, *node);
@@ -167,8 +172,12 @@ L2RateTracer::Drop(Ptr<const Packet> packet)
 {
   // no interface information... this should be part of this L2Tracer object data
 
-  std::get<0>(m_stats).m_drop++;
-  std::get<1>(m_stats).m_drop += packet->GetSize();
+  if (!m_sampler.IsSampled(packet->GetUid())) {
+    return;
+  }
+
+  std::get<0>(m_stats).m_drop += m_sampler.GetWeight();
+  std::get<1>(m_stats).m_drop += m_sampler.GetWeight() * packet->GetSize();
 }
 
 } // namespace ns3
@@ -21,6 +21,7 @@
 #define L2_TRACER_H
 
 #include "ns3/ndnSIM/model/ndn-common.hpp"
+#include "ns3/ndnSIM/utils/tracers/ndn-tracer-sampler.hpp"
 
 #include "ns3/ptr.h"
 #include "ns3/simple-ref-count.h"
@@ -53,12 +54,25 @@ public:
   virtual void
   Drop(Ptr<const Packet>) = 0;
 
+  /**
+   * @brief Trace only 1-in-@p rate packets, selected by packet UID (see TracerSampler)
+   *
+   * Counters of sampled packets are scaled by @p rate, so that printed values remain unbiased
+   * estimates of the real ones
+   */
+  void
+  SetSamplingRate(uint32_t rate)
+  {
+    m_sampler.SetRate(rate);
+  }
+
   // Rx/Tx is NetDevice specific
   // please refer to pyviz.cc in order to extend this tracer
 
 protected:
   std::string m_node;
   Ptr<Node> m_nodePtr;
+  ndn::TracerSampler m_sampler;
 
   struct Stats {
     void
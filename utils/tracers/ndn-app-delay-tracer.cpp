@@ -25,8 +25,10 @@
 #include "ns3/callback.h"
 
 #include "apps/ndn-app.hpp"
+#include "utils/ndn-profiler.hpp"
 #include "ns3/simulator.h"
 #include "ns3/node-list.h"
+#include "helper/ndn-partition-helper.hpp"
 #include "ns3/log.h"
 
 #include <boost/lexical_cast.hpp>
@@ -58,7 +60,8 @@ AppDelayTracer::InstallAll(const std::string& file)
   shared_ptr<std::ostream> outputStream;
   if (file != "-") {
     shared_ptr<std::ofstream> os(new std::ofstream());
-    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
+    os->open(PartitionHelper::GetLocalFileName(file).c_str(),
+             std::ios_base::out | std::ios_base::trunc);
 
     if (!os->is_open()) {
       NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
@@ -72,6 +75,9 @@ AppDelayTracer::InstallAll(const std::string& file)
   }
 
   for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+    if (!PartitionHelper::IsLocal(*node)) {
+      continue;
+    }
     Ptr<AppDelayTracer> trace = Install(*node, outputStream);
     tracers.push_back(trace);
   }
@@ -95,7 +101,8 @@ AppDelayTracer::Install(const NodeContainer& nodes, const std::string& file)
   shared_ptr<std::ostream> outputStream;
   if (file != "-") {
     shared_ptr<std::ofstream> os(new std::ofstream());
-    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
+    os->open(PartitionHelper::GetLocalFileName(file).c_str(),
+             std::ios_base::out | std::ios_base::trunc);
 
     if (!os->is_open()) {
       NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
@@ -132,7 +139,8 @@ AppDelayTracer::Install(Ptr<Node> node, const std::string& file)
   shared_ptr<std::ostream> outputStream;
   if (file != "-") {
     shared_ptr<std::ofstream> os(new std::ofstream());
-    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
+    os->open(PartitionHelper::GetLocalFileName(file).c_str(),
+             std::ios_base::out | std::ios_base::trunc);
 
     if (!os->is_open()) {
       NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
@@ -234,6 +242,11 @@ void
 AppDelayTracer::LastRetransmittedInterestDataDelay(Ptr<App> app, uint32_t seqno, Time delay,
                                                    int32_t hopCount)
 {
+  NDNSIM_PROFILE_SCOPE(TRACER_CALLBACK);
+  if (!m_sampler.IsSampled(seqno)) {
+    return;
+  }
+
   *m_os << Simulator::Now().ToDouble(Time::S) << "\t" << m_node << "\t" << app->GetId() << "\t"
         << seqno << "\t"
         << "LastDelay"
@@ -245,6 +258,11 @@ void
 AppDelayTracer::FirstInterestDataDelay(Ptr<App> app, uint32_t seqno, Time delay, uint32_t retxCount,
                                        int32_t hopCount)
 {
+  NDNSIM_PROFILE_SCOPE(TRACER_CALLBACK);
+  if (!m_sampler.IsSampled(seqno)) {
+    return;
+  }
+
   *m_os << Simulator::Now().ToDouble(Time::S) << "\t" << m_node << "\t" << app->GetId() << "\t"
         << seqno << "\t"
         << "FullDelay"
@@ -21,6 +21,7 @@
 #define CCNX_APP_DELAY_TRACER_H
 
 #include "ns3/ndnSIM/model/ndn-common.hpp"
+#include "ns3/ndnSIM/utils/tracers/ndn-tracer-sampler.hpp"
 
 #include "ns3/ptr.h"
 #include "ns3/simple-ref-count.h"
@@ -127,6 +128,18 @@ public:
   void
   PrintHeader(std::ostream& os) const;
 
+  /**
+   * @brief Print only delays of 1-in-@p rate sequence numbers (see TracerSampler)
+   *
+   * The same sequence numbers are selected in every run, so delay distributions of the sampled
+   * subset are directly comparable
+   */
+  void
+  SetSamplingRate(uint32_t rate)
+  {
+    m_sampler.SetRate(rate);
+  }
+
 private:
   void
   Connect();
@@ -141,6 +154,7 @@ private:
 private:
   std::string m_node;
   Ptr<Node> m_nodePtr;
+  TracerSampler m_sampler;
 
   shared_ptr<std::ostream> m_os;
 };
@@ -26,8 +26,10 @@
 
 #include "apps/ndn-app.hpp"
 #include "model/cs/ndn-content-store.hpp"
+#include "utils/ndn-profiler.hpp"
 #include "ns3/simulator.h"
 #include "ns3/node-list.h"
+#include "helper/ndn-partition-helper.hpp"
 #include "ns3/log.h"
 
 #include <boost/lexical_cast.hpp>
@@ -57,7 +59,8 @@ CsTracer::InstallAll(const std::string& file, Time averagingPeriod /* = Seconds
   shared_ptr<std::ostream> outputStream;
   if (file != "-") {
     shared_ptr<std::ofstream> os(new std::ofstream());
-    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
+    os->open(PartitionHelper::GetLocalFileName(file).c_str(),
+             std::ios_base::out | std::ios_base::trunc);
 
     if (!os->is_open()) {
       NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
@@ -71,6 +74,9 @@ CsTracer::InstallAll(const std::string& file, Time averagingPeriod /* = Seconds
   }
 
   for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+    if (!PartitionHelper::IsLocal(*node)) {
+      continue;
+    }
     Ptr<CsTracer> trace = Install(*node, outputStream, averagingPeriod);
     tracers.push_back(trace);
   }
@@ -95,7 +101,8 @@ CsTracer::Install(const NodeContainer& nodes, const std::string& file,
   shared_ptr<std::ostream> outputStream;
   if (file != "-") {
     shared_ptr<std::ofstream> os(new std::ofstream());
-    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
+    os->open(PartitionHelper::GetLocalFileName(file).c_str(),
+             std::ios_base::out | std::ios_base::trunc);
 
     if (!os->is_open()) {
       NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
@@ -133,7 +140,8 @@ CsTracer::Install(Ptr<Node> node, const std::string& file,
   shared_ptr<std::ostream> outputStream;
   if (file != "-") {
     shared_ptr<std::ofstream> os(new std::ofstream());
-    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
+    os->open(PartitionHelper::GetLocalFileName(file).c_str(),
+             std::ios_base::out | std::ios_base::trunc);
 
     if (!os->is_open()) {
       NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
@@ -261,12 +269,14 @@ CsTracer::Print(std::ostream& os) const
 void
 CsTracer::CacheHits(shared_ptr<const Interest>, shared_ptr<const Data>)
 {
+  NDNSIM_PROFILE_SCOPE(TRACER_CALLBACK);
   m_stats.m_cacheHits++;
 }
 
 void
 CsTracer::CacheMisses(shared_ptr<const Interest>)
 {
+  NDNSIM_PROFILE_SCOPE(TRACER_CALLBACK);
   m_stats.m_cacheMisses++;
 }
 
@@ -25,7 +25,9 @@
 #include "ns3/simulator.h"
 #include "ns3/log.h"
 #include "ns3/node-list.h"
+#include "ns3/ndnSIM/helper/ndn-partition-helper.hpp"
 #include "ns3/ndnSIM/model/ndn-l3-protocol.hpp"
+#include "ns3/ndnSIM/utils/ndn-profiler.hpp"
 
 #include "daemon/table/pit-entry.hpp"
 
@@ -53,7 +55,8 @@ L3RateTracer::InstallAll(const std::string& file, Time averagingPeriod /* = Seco
   shared_ptr<std::ostream> outputStream;
   if (file != "-") {
     shared_ptr<std::ofstream> os(new std::ofstream());
-    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
+    os->open(PartitionHelper::GetLocalFileName(file).c_str(),
+             std::ios_base::out | std::ios_base::trunc);
 
     if (!os->is_open()) {
       NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
@@ -67,6 +70,9 @@ L3RateTracer::InstallAll(const std::string& file, Time averagingPeriod /* = Seco
   }
 
   for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+    if (!PartitionHelper::IsLocal(*node)) {
+      continue;
+    }
     Ptr<L3RateTracer> trace = Install(*node, outputStream, averagingPeriod);
     tracers.push_back(trace);
   }
@@ -91,7 +97,8 @@ L3RateTracer::Install(const NodeContainer& nodes, const std::string& file,
   shared_ptr<std::ostream> outputStream;
   if (file != "-") {
     shared_ptr<std::ofstream> os(new std::ofstream());
-    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
+    os->open(PartitionHelper::GetLocalFileName(file).c_str(),
+             std::ios_base::out | std::ios_base::trunc);
 
     if (!os->is_open()) {
       NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
@@ -129,7 +136,8 @@ L3RateTracer::Install(Ptr<Node> node, const std::string& file,
   shared_ptr<std::ostream> outputStream;
   if (file != "-") {
     shared_ptr<std::ofstream> os(new std::ofstream());
-    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
+    os->open(PartitionHelper::GetLocalFileName(file).c_str(),
+             std::ios_base::out | std::ios_base::trunc);
 
     if (!os->is_open()) {
       NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
@@ -296,100 +304,140 @@ L3RateTracer::Print(std::ostream& os) const
 void
 L3RateTracer::OutInterests(const Interest& interest, const Face& face)
 {
+  NDNSIM_PROFILE_SCOPE(TRACER_CALLBACK);
+  if (!m_sampler.IsSampled(interest.getName())) {
+    return;
+  }
+
   AddInfo(face);
-  std::get<0>(m_stats[face.getId()]).m_outInterests++;
+  std::get<0>(m_stats[face.getId()]).m_outInterests += m_sampler.GetWeight();
   if (interest.hasWire()) {
     std::get<1>(m_stats[face.getId()]).m_outInterests +=
-      interest.wireEncode().size();
+      m_sampler.GetWeight() * interest.wireEncode().size();
   }
 }
 
 void
 L3RateTracer::InInterests(const Interest& interest, const Face& face)
 {
+  NDNSIM_PROFILE_SCOPE(TRACER_CALLBACK);
+  if (!m_sampler.IsSampled(interest.getName())) {
+    return;
+  }
+
   AddInfo(face);
-  std::get<0>(m_stats[face.getId()]).m_inInterests++;
+  std::get<0>(m_stats[face.getId()]).m_inInterests += m_sampler.GetWeight();
   if (interest.hasWire()) {
     std::get<1>(m_stats[face.getId()]).m_inInterests +=
-      interest.wireEncode().size();
+      m_sampler.GetWeight() * interest.wireEncode().size();
   }
 }
 
 void
 L3RateTracer::OutData(const Data& data, const Face& face)
 {
+  NDNSIM_PROFILE_SCOPE(TRACER_CALLBACK);
+  if (!m_sampler.IsSampled(data.getName())) {
+    return;
+  }
+
   AddInfo(face);
-  std::get<0>(m_stats[face.getId()]).m_outData++;
+  std::get<0>(m_stats[face.getId()]).m_outData += m_sampler.GetWeight();
   if (data.hasWire()) {
     std::get<1>(m_stats[face.getId()]).m_outData +=
-      data.wireEncode().size();
+      m_sampler.GetWeight() * data.wireEncode().size();
   }
 }
 
 void
 L3RateTracer::InData(const Data& data, const Face& face)
 {
+  NDNSIM_PROFILE_SCOPE(TRACER_CALLBACK);
+  if (!m_sampler.IsSampled(data.getName())) {
+    return;
+  }
+
   AddInfo(face);
-  std::get<0>(m_stats[face.getId()]).m_inData++;
+  std::get<0>(m_stats[face.getId()]).m_inData += m_sampler.GetWeight();
   if (data.hasWire()) {
     std::get<1>(m_stats[face.getId()]).m_inData +=
-      data.wireEncode().size();
+      m_sampler.GetWeight() * data.wireEncode().size();
   }
 }
 
 void
 L3RateTracer::OutNack(const lp::Nack& nack, const Face& face)
 {
+  NDNSIM_PROFILE_SCOPE(TRACER_CALLBACK);
+  if (!m_sampler.IsSampled(nack.getInterest().getName())) {
+    return;
+  }
+
   AddInfo(face);
-  std::get<0>(m_stats[face.getId()]).m_outNack++;
+  std::get<0>(m_stats[face.getId()]).m_outNack += m_sampler.GetWeight();
   if (nack.getInterest().hasWire()) {
     std::get<1>(m_stats[face.getId()]).m_outNack +=
-      nack.getInterest().wireEncode().size();
+      m_sampler.GetWeight() * nack.getInterest().wireEncode().size();
   }
 }
 
 void
 L3RateTracer::InNack(const lp::Nack& nack, const Face& face)
 {
+  NDNSIM_PROFILE_SCOPE(TRACER_CALLBACK);
+  if (!m_sampler.IsSampled(nack.getInterest().getName())) {
+    return;
+  }
+
   AddInfo(face);
-  std::get<0>(m_stats[face.getId()]).m_inNack++;
+  std::get<0>(m_stats[face.getId()]).m_inNack += m_sampler.GetWeight();
   if (nack.getInterest().hasWire()) {
     std::get<1>(m_stats[face.getId()]).m_inNack +=
-      nack.getInterest().wireEncode().size();
+      m_sampler.GetWeight() * nack.getInterest().wireEncode().size();
   }
 }
 
 void
 L3RateTracer::SatisfiedInterests(const nfd::pit::Entry& entry, const Face&, const Data&)
 {
-  std::get<0>(m_stats[nfd::face::INVALID_FACEID]).m_satisfiedInterests++;
+  NDNSIM_PROFILE_SCOPE(TRACER_CALLBACK);
+  if (!m_sampler.IsSampled(entry.getName())) {
+    return;
+  }
+
+  std::get<0>(m_stats[nfd::face::INVALID_FACEID]).m_satisfiedInterests += m_sampler.GetWeight();
   // no "size" stats
 
   for (const auto& in : entry.getInRecords()) {
     AddInfo(in.getFace());
-    std::get<0>(m_stats[(in.getFace()).getId()]).m_satisfiedInterests ++;
+    std::get<0>(m_stats[(in.getFace()).getId()]).m_satisfiedInterests += m_sampler.GetWeight();
   }
 
   for (const auto& out : entry.getOutRecords()) {
     AddInfo(out.getFace());
-    std::get<0>(m_stats[(out.getFace()).getId()]).m_outSatisfiedInterests ++;
+    std::get<0>(m_stats[(out.getFace()).getId()]).m_outSatisfiedInterests += m_sampler.GetWeight();
   }
 }
 
 void
 L3RateTracer::TimedOutInterests(const nfd::pit::Entry& entry)
 {
-  std::get<0>(m_stats[nfd::face::INVALID_FACEID]).m_timedOutInterests++;
+  NDNSIM_PROFILE_SCOPE(TRACER_CALLBACK);
+  if (!m_sampler.IsSampled(entry.getName())) {
+    return;
+  }
+
+  std::get<0>(m_stats[nfd::face::INVALID_FACEID]).m_timedOutInterests += m_sampler.GetWeight();
   // no "size" stats
 
   for (const auto& in : entry.getInRecords()) {
     AddInfo(in.getFace());
-    std::get<0>(m_stats[(in.getFace()).getId()]).m_timedOutInterests++;
+    std::get<0>(m_stats[(in.getFace()).getId()]).m_timedOutInterests += m_sampler.GetWeight();
   }
 
   for (const auto& out : entry.getOutRecords()) {
     AddInfo(out.getFace());
-    std::get<0>(m_stats[(out.getFace()).getId()]).m_outTimedOutInterests++;
+    std::get<0>(m_stats[(out.getFace()).getId()]).m_outTimedOutInterests += m_sampler.GetWeight();
   }
 }
 
@@ -21,6 +21,7 @@
 #define NDN_L3_TRACER_H
 
 #include "ns3/ndnSIM/model/ndn-common.hpp"
+#include "ns3/ndnSIM/utils/tracers/ndn-tracer-sampler.hpp"
 
 #include "ns3/ptr.h"
 #include "ns3/simple-ref-count.h"
@@ -77,6 +78,18 @@ public:
   virtual void
   Print(std::ostream& os) const = 0;
 
+  /**
+   * @brief Trace only 1-in-@p rate packets (see TracerSampler)
+   *
+   * Counters of sampled packets are scaled by @p rate, so that printed values remain unbiased
+   * estimates of the real ones
+   */
+  void
+  SetSamplingRate(uint32_t rate)
+  {
+    m_sampler.SetRate(rate);
+  }
+
 protected:
   void
   Connect();
@@ -108,6 +121,7 @@ protected:
 protected:
   std::string m_node;
   Ptr<Node> m_nodePtr;
+  TracerSampler m_sampler;
 
   struct Stats {
     inline void
@@ -0,0 +1,183 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-memory-tracer.hpp"
+
+#include "ns3/node.h"
+#include "ns3/names.h"
+#include "ns3/simulator.h"
+#include "ns3/node-list.h"
+#include "helper/ndn-partition-helper.hpp"
+#include "ns3/log.h"
+
+#include <boost/lexical_cast.hpp>
+
+#include <fstream>
+#include <unistd.h>
+
+#include "utils/mem-usage.hpp"
+
+NS_LOG_COMPONENT_DEFINE("ndn.MemoryTracer");
+
+namespace ns3 {
+namespace ndn {
+
+static std::list<std::tuple<shared_ptr<std::ostream>, Ptr<MemoryTracer>>> g_tracers;
+
+void
+MemoryTracer::Destroy()
+{
+  g_tracers.clear();
+}
+
+void
+MemoryTracer::InstallAll(const std::string& file, Time period /* = Seconds (1.0)*/,
+                         bool perNode /* = false*/)
+{
+  NodeContainer nodes;
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+    if (!PartitionHelper::IsLocal(*node)) {
+      continue;
+    }
+    nodes.Add(*node);
+  }
+
+  Install(nodes, file, period, perNode);
+}
+
+void
+MemoryTracer::Install(const NodeContainer& nodes, const std::string& file,
+                      Time period /* = Seconds (1.0)*/, bool perNode /* = false*/)
+{
+  shared_ptr<std::ostream> outputStream;
+  if (file != "-") {
+    shared_ptr<std::ofstream> os(new std::ofstream());
+    os->open(PartitionHelper::GetLocalFileName(file).c_str(),
+             std::ios_base::out | std::ios_base::trunc);
+
+    if (!os->is_open()) {
+      NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
+      return;
+    }
+
+    outputStream = os;
+  }
+  else {
+    outputStream = shared_ptr<std::ostream>(&std::cout, std::bind([]{}));
+  }
+
+  Ptr<MemoryTracer> trace = Create<MemoryTracer>(outputStream, nodes, perNode);
+  trace->SetPeriod(period);
+
+  trace->PrintHeader(*outputStream);
+  *outputStream << "\n";
+
+  g_tracers.push_back(std::make_tuple(outputStream, trace));
+}
+
+MemoryTracer::MemoryTracer(shared_ptr<std::ostream> os, const NodeContainer& nodes, bool perNode)
+  : m_nodes(nodes)
+  , m_perNode(perNode)
+  , m_os(os)
+{
+}
+
+MemoryTracer::~MemoryTracer()
+{
+  m_printEvent.Cancel();
+}
+
+void
+MemoryTracer::SetPeriod(const Time& period)
+{
+  m_period = period;
+  m_printEvent.Cancel();
+  m_printEvent = Simulator::Schedule(m_period, &MemoryTracer::PeriodicPrinter, this);
+}
+
+void
+MemoryTracer::PeriodicPrinter()
+{
+  Print(*m_os);
+
+  m_printEvent = Simulator::Schedule(m_period, &MemoryTracer::PeriodicPrinter, this);
+}
+
+void
+MemoryTracer::PrintHeader(std::ostream& os) const
+{
+  os << "Time"
+     << "\t"
+
+     << "Node"
+     << "\t"
+
+     << "Type"
+     << "\t"
+     << "Entries"
+     << "\t"
+     << "Bytes";
+}
+
+#define PRINTER(printName, entries, bytes)                                                         \
+  os << time.ToDouble(Time::S) << "\t" << node << "\t" << printName << "\t" << entries << "\t"     \
+     << bytes << "\n";
+
+void
+MemoryTracer::PrintUsage(std::ostream& os, const std::string& node,
+                         const TableMemoryUsage& usage) const
+{
+  Time time = Simulator::Now();
+
+  PRINTER("CsData", usage.m_csEntries, usage.m_csData);
+  PRINTER("CsTrie", usage.m_csEntries, usage.m_csTrie);
+  PRINTER("CsPolicy", usage.m_csEntries, usage.m_csPolicy);
+  PRINTER("Pit", usage.m_pitEntries, usage.m_pit);
+  PRINTER("Fib", usage.m_fibEntries, usage.m_fib);
+  PRINTER("NameTree", 0, usage.m_nameTree);
+  PRINTER("Total", usage.m_csEntries + usage.m_pitEntries + usage.m_fibEntries,
+          usage.GetTotal());
+}
+
+void
+MemoryTracer::Print(std::ostream& os) const
+{
+  TableMemoryUsage total;
+  for (NodeContainer::Iterator node = m_nodes.Begin(); node != m_nodes.End(); node++) {
+    TableMemoryUsage usage = TableMemoryUsage::Get(*node);
+    total += usage;
+
+    if (m_perNode) {
+      std::string name = Names::FindName(*node);
+      if (name.empty()) {
+        name = boost::lexical_cast<std::string>((*node)->GetId());
+      }
+      PrintUsage(os, name, usage);
+    }
+  }
+
+  PrintUsage(os, "all", total);
+
+  Time time = Simulator::Now();
+  std::string node = "all";
+  PRINTER("Rss", 0, MemUsage::Get());
+}
+
+} // namespace ndn
+} // namespace ns3
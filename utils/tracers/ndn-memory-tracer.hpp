@@ -0,0 +1,127 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_MEMORY_TRACER_H
+#define NDN_MEMORY_TRACER_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+#include "ns3/ndnSIM/utils/ndn-memory-usage.hpp"
+
+#include "ns3/ptr.h"
+#include "ns3/simple-ref-count.h"
+#include <ns3/nstime.h>
+#include <ns3/event-id.h>
+#include <ns3/node-container.h>
+
+#include <list>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-tracers
+ * @brief NDN tracer for memory used by content stores, PIT, FIB, and name tree
+ *
+ * Periodically walks tables of the traced nodes (see TableMemoryUsage) and prints network-wide
+ * number of entries and bytes per table (node "all"), together with the process RSS.  Optionally,
+ * the same statistics are printed for every traced node.
+ */
+class MemoryTracer : public SimpleRefCount<MemoryTracer> {
+public:
+  /**
+   * @brief Helper method to install tracer on all simulation nodes
+   *
+   * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param period How often data will be written into the trace file (default, every second)
+   * @param perNode If true, print statistics for every node in addition to network-wide totals
+   */
+  static void
+  InstallAll(const std::string& file, Time period = Seconds(1.0), bool perNode = false);
+
+  /**
+   * @brief Helper method to install tracer on the selected simulation nodes
+   *
+   * @param nodes Nodes which tables will be traced
+   * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param period How often data will be written into the trace file (default, every second)
+   * @param perNode If true, print statistics for every node in addition to totals
+   */
+  static void
+  Install(const NodeContainer& nodes, const std::string& file, Time period = Seconds(1.0),
+          bool perNode = false);
+
+  /**
+   * @brief Explicit request to remove all statically created tracers
+   *
+   * This method can be helpful if simulation scenario contains several independent run,
+   * or if it is desired to do a postprocessing of the resulting data
+   */
+  static void
+  Destroy();
+
+  /**
+   * @brief Trace constructor
+   * @param os      reference to the output stream
+   * @param nodes   nodes which tables will be traced
+   * @param perNode whether statistics for individual nodes should be printed
+   */
+  MemoryTracer(shared_ptr<std::ostream> os, const NodeContainer& nodes, bool perNode);
+
+  ~MemoryTracer();
+
+  /**
+   * @brief Print head of the trace (e.g., for post-processing)
+   *
+   * @param os reference to output stream
+   */
+  void
+  PrintHeader(std::ostream& os) const;
+
+  /**
+   * @brief Print current trace data
+   *
+   * @param os reference to output stream
+   */
+  void
+  Print(std::ostream& os) const;
+
+private:
+  void
+  SetPeriod(const Time& period);
+
+  void
+  PeriodicPrinter();
+
+  void
+  PrintUsage(std::ostream& os, const std::string& node, const TableMemoryUsage& usage) const;
+
+private:
+  NodeContainer m_nodes;
+  bool m_perNode;
+
+  shared_ptr<std::ostream> m_os;
+
+  Time m_period;
+  EventId m_printEvent;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_MEMORY_TRACER_H
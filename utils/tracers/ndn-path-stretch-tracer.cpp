@@ -0,0 +1,212 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-path-stretch-tracer.hpp"
+
+#include "ns3/node.h"
+#include "ns3/config.h"
+#include "ns3/callback.h"
+#include "ns3/simulator.h"
+#include "ns3/node-list.h"
+#include "helper/ndn-partition-helper.hpp"
+#include "ns3/log.h"
+
+#include "apps/ndn-app.hpp"
+#include "utils/ndn-profiler.hpp"
+
+#include <boost/lexical_cast.hpp>
+
+#include <fstream>
+
+NS_LOG_COMPONENT_DEFINE("ndn.PathStretchTracer");
+
+namespace ns3 {
+namespace ndn {
+
+static std::list<std::tuple<shared_ptr<std::ostream>, Ptr<PathStretchTracer>>> g_tracers;
+
+void
+PathStretchTracer::Destroy()
+{
+  g_tracers.clear();
+}
+
+void
+PathStretchTracer::InstallAll(const std::string& file, Time period /* = Seconds (10.0)*/)
+{
+  NodeContainer nodes;
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+    if (!PartitionHelper::IsLocal(*node)) {
+      continue;
+    }
+    nodes.Add(*node);
+  }
+
+  Install(nodes, file, period);
+}
+
+void
+PathStretchTracer::Install(const NodeContainer& nodes, const std::string& file,
+                           Time period /* = Seconds (10.0)*/)
+{
+  shared_ptr<std::ostream> outputStream;
+  if (file != "-") {
+    shared_ptr<std::ofstream> os(new std::ofstream());
+    os->open(PartitionHelper::GetLocalFileName(file).c_str(),
+             std::ios_base::out | std::ios_base::trunc);
+
+    if (!os->is_open()) {
+      NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
+      return;
+    }
+
+    outputStream = os;
+  }
+  else {
+    outputStream = shared_ptr<std::ostream>(&std::cout, std::bind([]{}));
+  }
+
+  Ptr<PathStretchTracer> trace = Create<PathStretchTracer>(outputStream, nodes);
+  trace->SetPeriod(period);
+
+  trace->PrintHeader(*outputStream);
+  *outputStream << "\n";
+
+  g_tracers.push_back(std::make_tuple(outputStream, trace));
+}
+
+PathStretchTracer::PathStretchTracer(shared_ptr<std::ostream> os, const NodeContainer& nodes)
+  : m_os(os)
+{
+  for (NodeContainer::Iterator node = nodes.Begin(); node != nodes.End(); node++) {
+    Config::ConnectWithoutContext("/NodeList/" + boost::lexical_cast<std::string>((*node)->GetId())
+                                    + "/ApplicationList/*/PathStretchSample",
+                                  MakeCallback(&PathStretchTracer::PathStretch, this));
+  }
+}
+
+PathStretchTracer::~PathStretchTracer()
+{
+  m_printEvent.Cancel();
+}
+
+void
+PathStretchTracer::SetPeriod(const Time& period)
+{
+  m_period = period;
+  m_printEvent.Cancel();
+  m_printEvent = Simulator::Schedule(m_period, &PathStretchTracer::PeriodicPrinter, this);
+}
+
+void
+PathStretchTracer::PeriodicPrinter()
+{
+  Print(*m_os);
+  Reset();
+
+  m_printEvent = Simulator::Schedule(m_period, &PathStretchTracer::PeriodicPrinter, this);
+}
+
+void
+PathStretchTracer::Reset()
+{
+  m_total = Stats();
+  m_locations.clear();
+}
+
+void
+PathStretchTracer::PrintHeader(std::ostream& os) const
+{
+  os << "Time"
+     << "\t"
+     << "Location"
+     << "\t"
+     << "Type"
+     << "\t"
+     << "Count"
+     << "\t"
+     << "Mean"
+     << "\t"
+     << "StdDev"
+     << "\t"
+     << "Min"
+     << "\t"
+     << "P50"
+     << "\t"
+     << "P90"
+     << "\t"
+     << "P99"
+     << "\t"
+     << "Max";
+}
+
+#define PRINTER(printName, fieldName)                                                              \
+  os << time.ToDouble(Time::S) << "\t" << location << "\t" << printName << "\t"                    \
+     << stats.fieldName.GetCount() << "\t" << stats.fieldName.GetMean() << "\t"                    \
+     << stats.fieldName.GetStdDev() << "\t" << stats.fieldName.GetMin() << "\t"                    \
+     << stats.fieldName.GetQuantile(0.5) << "\t" << stats.fieldName.GetQuantile(0.9) << "\t"       \
+     << stats.fieldName.GetQuantile(0.99) << "\t" << stats.fieldName.GetMax() << "\n";
+
+void
+PathStretchTracer::PrintStats(std::ostream& os, const std::string& location,
+                              const Stats& stats) const
+{
+  Time time = Simulator::Now();
+
+  PRINTER("HopCount", m_hopCount);
+  PRINTER("Stretch", m_stretch);
+  PRINTER("DelayS", m_delay);
+  PRINTER("LocatorCacheHit", m_locatorCacheHit);
+}
+
+void
+PathStretchTracer::Print(std::ostream& os) const
+{
+  if (m_total.m_delay.GetCount() == 0) {
+    return;
+  }
+
+  PrintStats(os, "all", m_total);
+  for (const auto& location : m_locations) {
+    PrintStats(os, boost::lexical_cast<std::string>(location.first), location.second);
+  }
+}
+
+void
+PathStretchTracer::PathStretch(Ptr<App>, uint32_t producerLocation, int32_t hopCount,
+                               int32_t, int32_t stretch, Time delay, bool isLocatorCacheHit)
+{
+  NDNSIM_PROFILE_SCOPE(TRACER_CALLBACK);
+
+  double delayS = delay.ToDouble(Time::S);
+
+  m_total.m_hopCount.Add(hopCount);
+  m_total.m_stretch.Add(stretch);
+  m_total.m_delay.Add(delayS);
+  m_total.m_locatorCacheHit.Add(isLocatorCacheHit ? 1 : 0);
+
+  Stats& stats = m_locations[producerLocation];
+  stats.m_hopCount.Add(hopCount);
+  stats.m_stretch.Add(stretch);
+  stats.m_delay.Add(delayS);
+  stats.m_locatorCacheHit.Add(isLocatorCacheHit ? 1 : 0);
+}
+
+} // namespace ndn
+} // namespace ns3
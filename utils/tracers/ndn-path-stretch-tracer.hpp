@@ -0,0 +1,145 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_PATH_STRETCH_TRACER_H
+#define NDN_PATH_STRETCH_TRACER_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+#include "ns3/ndnSIM/utils/ndn-streaming-stats.hpp"
+
+#include "ns3/ptr.h"
+#include "ns3/simple-ref-count.h"
+#include <ns3/nstime.h>
+#include <ns3/event-id.h>
+#include <ns3/node-container.h>
+
+#include <list>
+#include <map>
+
+namespace ns3 {
+namespace ndn {
+
+class App;
+
+/**
+ * @ingroup ndn-tracers
+ * @brief Tracer that summarizes path stretch reported by ProbeConsumer applications
+ *
+ * Instead of writing a line for every received Data, the tracer keeps online statistics (see
+ * StreamingStats) of hop count, path stretch, delay, and locator cache hits (mean is the hit
+ * rate, see ProbeConsumer LocatorCache attribute), both for all producer locations and
+ * for each location separately, and periodically prints their summaries.  Statistics are reset
+ * after each period.
+ */
+class PathStretchTracer : public SimpleRefCount<PathStretchTracer> {
+public:
+  /**
+   * @brief Helper method to install tracer on all simulation nodes
+   *
+   * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param period How often summaries will be written into the trace file (default, every 10
+   *        seconds)
+   */
+  static void
+  InstallAll(const std::string& file, Time period = Seconds(10.0));
+
+  /**
+   * @brief Helper method to install tracer on the selected simulation nodes
+   *
+   * @param nodes Nodes on which ProbeConsumer applications will be traced
+   * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param period How often summaries will be written into the trace file (default, every 10
+   *        seconds)
+   */
+  static void
+  Install(const NodeContainer& nodes, const std::string& file, Time period = Seconds(10.0));
+
+  /**
+   * @brief Explicit request to remove all statically created tracers
+   *
+   * This method can be helpful if simulation scenario contains several independent run,
+   * or if it is desired to do a postprocessing of the resulting data
+   */
+  static void
+  Destroy();
+
+  /**
+   * @brief Trace constructor
+   * @param os    reference to the output stream
+   * @param nodes nodes on which ProbeConsumer applications will be traced
+   */
+  PathStretchTracer(shared_ptr<std::ostream> os, const NodeContainer& nodes);
+
+  ~PathStretchTracer();
+
+  /**
+   * @brief Print head of the trace (e.g., for post-processing)
+   *
+   * @param os reference to output stream
+   */
+  void
+  PrintHeader(std::ostream& os) const;
+
+  /**
+   * @brief Print summaries of the current period
+   *
+   * @param os reference to output stream
+   */
+  void
+  Print(std::ostream& os) const;
+
+private:
+  void
+  SetPeriod(const Time& period);
+
+  void
+  PeriodicPrinter();
+
+  void
+  Reset();
+
+  void
+  PathStretch(Ptr<App> app, uint32_t producerLocation, int32_t hopCount, int32_t shortestPath,
+              int32_t stretch, Time delay, bool isLocatorCacheHit);
+
+private:
+  struct Stats {
+    StreamingStats m_hopCount;
+    StreamingStats m_stretch;
+    StreamingStats m_delay;
+    StreamingStats m_locatorCacheHit; ///< @brief 1 if Data came from the cached locator
+  };
+
+  void
+  PrintStats(std::ostream& os, const std::string& location, const Stats& stats) const;
+
+private:
+  shared_ptr<std::ostream> m_os;
+
+  Time m_period;
+  EventId m_printEvent;
+
+  Stats m_total;
+  std::map<uint32_t, Stats> m_locations;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_PATH_STRETCH_TRACER_H
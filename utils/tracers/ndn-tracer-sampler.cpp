@@ -0,0 +1,57 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-tracer-sampler.hpp"
+
+#include "ns3/global-value.h"
+#include "ns3/uinteger.h"
+#include "ns3/log.h"
+#include "ns3/abort.h"
+
+NS_LOG_COMPONENT_DEFINE("ndn.TracerSampler");
+
+namespace ns3 {
+namespace ndn {
+
+static GlobalValue g_samplingRate("NdnTracerSamplingRate",
+                                  "Default 1-in-N sampling rate of NDN per-packet tracers",
+                                  UintegerValue(1), MakeUintegerChecker<uint32_t>(1));
+
+TracerSampler::TracerSampler()
+{
+  UintegerValue rate;
+  g_samplingRate.GetValue(rate);
+  SetRate(rate.Get());
+}
+
+TracerSampler::TracerSampler(uint32_t rate)
+{
+  SetRate(rate);
+}
+
+void
+TracerSampler::SetRate(uint32_t rate)
+{
+  NS_ABORT_MSG_IF(rate == 0, "Sampling rate should be at least 1");
+  NS_LOG_DEBUG("Sampling 1 in " << rate);
+  m_rate = rate;
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,97 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_TRACER_SAMPLER_H
+#define NDN_TRACER_SAMPLER_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+#include "ns3/ndnSIM/utils/ndn-name-hash.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-tracers
+ * @brief Deterministic 1-in-N sampler for per-packet tracers
+ *
+ * Decision is made by hashing a flow key (packet name, application sequence number, or ns-3
+ * packet UID), so the same Interest and Data are sampled (or skipped) on every node and every
+ * run.  Sampled events are expected to be accounted with weight GetWeight(), which keeps counter
+ * estimates unbiased.
+ *
+ * Default rate is taken from "NdnTracerSamplingRate" global value (1, i.e., no sampling), which
+ * can be set with Config::SetGlobal or --NdnTracerSamplingRate=N on the command line.
+ */
+class TracerSampler {
+public:
+  /**
+   * @brief Create sampler using the current value of "NdnTracerSamplingRate" global value
+   */
+  TracerSampler();
+
+  explicit TracerSampler(uint32_t rate);
+
+  /**
+   * @brief Set sampling rate (1-in-@p rate events will be sampled)
+   */
+  void
+  SetRate(uint32_t rate);
+
+  uint32_t
+  GetRate() const
+  {
+    return m_rate;
+  }
+
+  /**
+   * @brief Weight of each sampled event (inverse of sampling probability)
+   */
+  double
+  GetWeight() const
+  {
+    return m_rate;
+  }
+
+  bool
+  IsSampled(const Name& name) const
+  {
+    return m_rate == 1 || IsSampledHash(NameHash::Mix(NameHash::Hash(name)));
+  }
+
+  bool
+  IsSampled(uint64_t key) const
+  {
+    return m_rate == 1 || IsSampledHash(NameHash::Mix(key));
+  }
+
+private:
+  bool
+  IsSampledHash(uint64_t hash) const
+  {
+    return hash % m_rate == 0;
+  }
+
+private:
+  uint32_t m_rate;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_TRACER_SAMPLER_H
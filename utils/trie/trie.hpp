@@ -453,6 +453,37 @@ public:
     return key_;
   }
 
+  /**
+   * @brief Number of nodes in the subtree rooted at this node (including this node)
+   */
+  size_t
+  node_count() const
+  {
+    size_t count = 1;
+    for (typename unordered_set::const_iterator subnode = children_.begin();
+         subnode != children_.end(); subnode++) {
+      count += subnode->node_count();
+    }
+    return count;
+  }
+
+  /**
+   * @brief Approximate number of bytes used by the subtree rooted at this node
+   *
+   * Includes node objects (with embedded policy hooks), hash bucket arrays, and name component
+   * buffers, but not the payloads
+   */
+  size_t
+  memory_usage() const
+  {
+    size_t bytes = sizeof(trie) + bucketSize_ * sizeof(bucket_type) + key_.size();
+    for (typename unordered_set::const_iterator subnode = children_.begin();
+         subnode != children_.end(); subnode++) {
+      bytes += subnode->memory_usage();
+    }
+    return bytes;
+  }
+
   inline void
   PrintStat(std::ostream& os) const;
 